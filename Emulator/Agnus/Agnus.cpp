@@ -308,29 +308,14 @@ Agnus::executeUntilBusIsFree()
 {    
     isize posh = pos.h == 0 ? HPOS_MAX : pos.h - 1;
 
+    // Let a pending Copper run catch up
+    if (copper.runEnd) copper.commitRun(posh);
+
     // Check if the bus is blocked
     if (busOwner[posh] != BUS_NONE) {
 
-        // This variable counts the number of DMA cycles the CPU will be suspended
-        DMACycle delay = 0;
-
-        // Execute Agnus until the bus is free
-        do {
-            
-            /*
-            if (pos.v >= 0x66 && pos.v <= 0x66) {
-                trace(true, "CPU blocked in %ld by %s\n", posh, BusOwnerEnum::key(busOwner[posh]));
-            }
-            */
-            
-            posh = pos.h;
-            execute();
-            if (++delay == 2) bls = true;
-            
-        } while (busOwner[posh] != BUS_NONE);
-
-        // Clear the BLS line (Blitter slow down)
-        bls = false;
+        // Wait until the bus is free
+        DMACycle delay = executeWhileBusIsBlocked(posh);
 
         // Add wait states to the CPU
         cpu.addWaitStates(DMA_CYCLES(delay));
@@ -353,24 +338,15 @@ Agnus::executeUntilBusIsFreeForCIA()
     syncWithEClock();
     
     isize posh = pos.h == 0 ? HPOS_MAX : pos.h - 1;
-    
-    // Check if the bus is blocked
-    if (busOwner[posh] != BUS_NONE) {
-
-        // This variable counts the number of DMA cycles the CPU will be suspended
-        DMACycle delay = 0;
 
-        // Execute Agnus until the bus is free
-        do {
+    // Let a pending Copper run catch up
+    if (copper.runEnd) copper.commitRun(posh);
 
-            posh = pos.h;
-            execute();
-            if (++delay == 2) bls = true;
-            
-        } while (busOwner[posh] != BUS_NONE);
+    // Check if the bus is blocked
+    if (busOwner[posh] != BUS_NONE) {
 
-        // Clear the BLS line (Blitter slow down)
-        bls = false;
+        // Wait until the bus is free
+        DMACycle delay = executeWhileBusIsBlocked(posh);
 
         // Add wait states to the CPU
         cpu.addWaitStates(DMA_CYCLES(delay));
@@ -380,6 +356,28 @@ Agnus::executeUntilBusIsFreeForCIA()
     busOwner[posh] = BUS_CPU;
 }
 
+DMACycle
+Agnus::executeWhileBusIsBlocked(isize &posh)
+{
+    // This variable counts the number of DMA cycles the CPU will be suspended
+    DMACycle delay = 0;
+
+    // Execute Agnus until the bus is free
+    do {
+
+        posh = pos.h;
+        execute();
+        if (copper.runEnd) copper.commitRun(posh);
+        if (++delay == 2) bls = true;
+
+    } while (busOwner[posh] != BUS_NONE);
+
+    // Clear the BLS line (Blitter slow down)
+    bls = false;
+
+    return delay;
+}
+
 void
 Agnus::recordRegisterChange(Cycle delay, u32 addr, u16 value, Accessor acc)
 {
@@ -510,6 +508,9 @@ Agnus::executeUntil(Cycle cycle) {
             if (isDue<SLOT_SER>(cycle)) {
                 remoteManager.serServer.serviceSerEvent();
             }
+            if (isDue<SLOT_INP>(cycle)) {
+                inputRecorder.serviceInputEvent();
+            }
             if (isDue<SLOT_INS>(cycle)) {
                 agnus.serviceINSEvent(id[SLOT_INS]);
             }
@@ -712,6 +713,7 @@ Agnus::vsyncHandler()
     controlPort1.joystick.vsyncHandler();
     controlPort2.joystick.vsyncHandler();
     retroShell.vsyncHandler();
+    inputRecorder.vsyncHandler();
 
     // Update statistics
     updateStats();
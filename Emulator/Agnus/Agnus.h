@@ -38,7 +38,9 @@ class Agnus : public SubComponent {
 
     // Result of the latest inspection
     mutable AgnusInfo info = {};
+    mutable util::Seqlock<AgnusInfo> publishedInfo;
     mutable EventInfo eventInfo = {};
+    mutable util::Seqlock<EventInfo> publishedEventInfo;
     mutable EventSlotInfo slotInfo[SLOT_COUNT];
 
     // Current workload
@@ -331,8 +333,8 @@ public:
     
 public:
     
-    AgnusInfo getInfo() const { return AmigaComponent::getInfo(info); }
-    EventInfo getEventInfo() const { return AmigaComponent::getInfo(eventInfo); }
+    AgnusInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
+    EventInfo getEventInfo() const { return AmigaComponent::getInfo(eventInfo, publishedEventInfo); }
     EventSlotInfo getSlotInfo(isize nr) const; 
     const AgnusStats &getStats() { return stats; }
     
@@ -437,6 +439,9 @@ public:
     // Executes Agnus until the CPU can acquire the bus
     void executeUntilBusIsFree();
     void executeUntilBusIsFreeForCIA();
+
+    // Executes Agnus as long as the bus is blocked (returns the delay)
+    DMACycle executeWhileBusIsBlocked(isize &posh);
     
     // Schedules a register to change its value
     void recordRegisterChange(Cycle delay, u32 addr, u16 value, Accessor acc = 0);
@@ -506,6 +511,7 @@ public:
     template <int channel> u16 doBitplaneDmaRead();
     template <int channel> u16 doSpriteDmaRead();
     u16 doCopperDmaRead(u32 addr);
+    u16 doCopperDmaRead(u32 addr, isize h);
     u16 doBlitterDmaRead(u32 addr);
 
     // Performs a DMA write
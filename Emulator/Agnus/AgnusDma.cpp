@@ -142,10 +142,18 @@ Agnus::doSpriteDmaRead()
 u16
 Agnus::doCopperDmaRead(u32 addr)
 {
+    return doCopperDmaRead(addr, pos.h);
+}
+
+u16
+Agnus::doCopperDmaRead(u32 addr, isize h)
+{
+    assert(h >= 0 && h < HPOS_CNT);
+
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (addr);
 
-    busOwner[pos.h] = BUS_COPPER;
-    busValue[pos.h] = result;
+    busOwner[h] = BUS_COPPER;
+    busValue[h] = result;
     stats.usage[BUS_COPPER]++;
 
     return result;
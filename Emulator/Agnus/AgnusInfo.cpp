@@ -189,6 +189,7 @@ Agnus::eventName(EventSlot slot, EventID id)
                 case COP_JMP1:         return "COP_JMP1";
                 case COP_JMP2:         return "COP_JMP2";
                 case COP_VBLANK:       return "COP_VBLANK";
+                case COP_RUN:          return "COP_RUN";
                 default:               return "*** INVALID ***";
             }
             break;
@@ -412,6 +413,16 @@ Agnus::eventName(EventSlot slot, EventID id)
                 default:                return "*** INVALID ***";
             }
             break;
+
+        case SLOT_INP:
+
+            switch (id) {
+
+                case EVENT_NONE:        return "none";
+                case INP_REPLAY:        return "INP_REPLAY";
+                default:                return "*** INVALID ***";
+            }
+            break;
             
         case SLOT_INS:
 
@@ -621,6 +632,9 @@ Agnus::_inspect() const
     for (EventSlot i = 0; i < SLOT_COUNT; i++) {
         inspectSlot(i);
     }
+
+    publishedInfo.write(info);
+    publishedEventInfo.write(eventInfo);
 }
 
 void
@@ -109,6 +109,7 @@ enum_long(SLOT)
     SLOT_KEY,                       // Auto-typing
     SLOT_SRV,                       // Remote server manager
     SLOT_SER,                       // Serial remote server
+    SLOT_INP,                       // Input recorder
     SLOT_INS,                       // Handles periodic calls to inspect()
 
     SLOT_COUNT
@@ -164,6 +165,7 @@ struct EventSlotEnum : util::Reflection<EventSlotEnum, EventSlot>
             case SLOT_KEY:   return "KEY";
             case SLOT_SRV:   return "SRV";
             case SLOT_SER:   return "SER";
+            case SLOT_INP:   return "INP";
             case SLOT_INS:   return "INS";
 
             case SLOT_COUNT: return "???";
@@ -258,6 +260,7 @@ enum_i8(EventID)
     COP_JMP1,
     COP_JMP2,
     COP_VBLANK,
+    COP_RUN,
     COP_EVENT_COUNT,
     
     // Blitter slot
@@ -367,6 +370,10 @@ enum_i8(EventID)
     // Serial remote server
     SER_RECEIVE         = 1,
     SER_EVENT_COUNT,
+
+    // Input recorder
+    INP_REPLAY          = 1,
+    INP_EVENT_COUNT,
     
     // Inspector slot
     INS_AMIGA           = 1,
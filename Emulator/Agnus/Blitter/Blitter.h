@@ -37,6 +37,7 @@ class Blitter : public SubComponent
 
     // Result of the latest inspection
     mutable BlitterInfo info = {};
+    mutable util::Seqlock<BlitterInfo> publishedInfo;
 
     // The fill pattern lookup tables
     u8 fillPattern[2][2][256];     // [inclusive/exclusive][carry in][data]
@@ -91,6 +92,9 @@ class Blitter : public SubComponent
     // The Fast Blitter's blit functions
     void (Blitter::*blitfunc[32])(void);
 
+    // Maximum number of words processed in a single chunk
+    static constexpr isize fastChunkSize = 32;
+
 
     //
     // Slow Blitter
@@ -299,7 +303,7 @@ public:
     
 public:
     
-    BlitterInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    BlitterInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
 
     //
@@ -460,6 +464,18 @@ private:
     template <bool useA, bool useB, bool useC, bool useD, bool desc>
     void doFastCopyBlit();
 
+    /* Processes up to 'fastChunkSize' words of a blit row in one go. Chip Ram
+     * is accessed directly and each circuit is run across the whole chunk,
+     * which allows the compiler to vectorize the loops. Returns false if the
+     * chunk leaves Chip Ram or if a D write would affect a later source read
+     * within the chunk. In this case, the caller falls back to the
+     * word-by-word implementation.
+     */
+    template <bool useA, bool useB, bool useC, bool useD, bool desc>
+    bool doFastCopyChunk(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt,
+                         isize count, u16 fwm, u16 lwm,
+                         bool fill, bool &fillCarry);
+
     // Performs a line blit operation via the FastBlitter
     void doFastLineBlit();
 
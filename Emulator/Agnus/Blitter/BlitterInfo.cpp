@@ -125,4 +125,6 @@ Blitter::_inspect() const
     info.fco = fillCarry;
     info.fillEnable = bltconFE();
     info.storeToDest = bltconUSED() && !lockD;
+
+    publishedInfo.write(info);
 }
@@ -96,69 +96,78 @@ void Blitter::doFastCopyBlit()
         // Reset the fill carry bit
         fillCarry = !!bltconFCI();
 
-        // Apply the "first word mask" in the first iteration
-        u16 mask = bltafwm;
+        for (isize x = 0; x < bltsizeH; ) {
 
-        for (isize x = 0; x < bltsizeH; x++) {
+            isize count = std::min(isize(bltsizeH) - x, fastChunkSize);
 
-            // Apply the "last word mask" in the last iteration
-            if (x == bltsizeH - 1) mask &= bltalwm;
+            // Apply the "first word mask" and the "last word mask" at the borders
+            u16 fwm = x == 0 ? bltafwm : 0xFFFF;
+            u16 lwm = x + count == bltsizeH ? bltalwm : 0xFFFF;
+            x += count;
 
-            // Fetch A
-            if (useA) {
-                anew = mem.peek16 <ACCESSOR_AGNUS> (apt);
-                trace(BLT_DEBUG, "    A = %X <- %X\n", anew, apt);
-                apt = U32_ADD(apt, incr);
-            }
+            // Process the chunk as a whole if possible
+            if (doFastCopyChunk<useA, useB, useC, useD, desc>
+                (apt, bpt, cpt, dpt, count, fwm, lwm, fill, fillCarry)) continue;
 
-            // Fetch B
-            if (useB) {
-                bnew = mem.peek16 <ACCESSOR_AGNUS> (bpt);
-                trace(BLT_DEBUG, "    B = %X <- %X\n", bnew, bpt);
-                bpt = U32_ADD(bpt, incr);
-            }
+            // Otherwise, process the chunk word by word
+            for (isize i = 0; i < count; i++) {
 
-            // Fetch C
-            if (useC) {
-                chold = mem.peek16 <ACCESSOR_AGNUS> (cpt);
-                trace(BLT_DEBUG, "    C = %X <- %X\n", chold, cpt);
-                cpt = U32_ADD(cpt, incr);
-            }
-            
-            // Run the barrel shifter on path A (even if channel A is disabled)
-            ahold = barrelShifter(anew & mask, aold, bltconASH(), desc);
-            aold = anew & mask;
-                        
-            // Run the barrel shifter on path B (if channel B is enabled)
-            if (useB) {
-                bhold = barrelShifter(bnew, bold, bltconBSH(), desc);
-                bold = bnew;
-            }
-            
-            // Run the minterm circuit
-            dhold = doMintermLogic(ahold, bhold, chold, bltcon0 & 0xFF);
+                u16 mask = i == 0 ? fwm : 0xFFFF;
+                if (i == count - 1) mask &= lwm;
+
+                // Fetch A
+                if (useA) {
+                    anew = mem.peek16 <ACCESSOR_AGNUS> (apt);
+                    trace(BLT_DEBUG, "    A = %X <- %X\n", anew, apt);
+                    apt = U32_ADD(apt, incr);
+                }
 
-            // Run the fill logic circuit
-            if (fill) doFill(dhold, fillCarry);
+                // Fetch B
+                if (useB) {
+                    bnew = mem.peek16 <ACCESSOR_AGNUS> (bpt);
+                    trace(BLT_DEBUG, "    B = %X <- %X\n", bnew, bpt);
+                    bpt = U32_ADD(bpt, incr);
+                }
 
-            // Update the zero flag
-            if (dhold) bzero = false;
+                // Fetch C
+                if (useC) {
+                    chold = mem.peek16 <ACCESSOR_AGNUS> (cpt);
+                    trace(BLT_DEBUG, "    C = %X <- %X\n", chold, cpt);
+                    cpt = U32_ADD(cpt, incr);
+                }
 
-            // Write D
-            if (useD) {
-                mem.poke16 <ACCESSOR_AGNUS> (dpt, dhold);
+                // Run the barrel shifter on path A (even if channel A is disabled)
+                ahold = barrelShifter(anew & mask, aold, bltconASH(), desc);
+                aold = anew & mask;
 
-                if (BLT_CHECKSUM) {
-                    check1 = util::fnvIt32(check1, dhold);
-                    check2 = util::fnvIt32(check2, dpt & agnus.ptrMask);
+                // Run the barrel shifter on path B (if channel B is enabled)
+                if (useB) {
+                    bhold = barrelShifter(bnew, bold, bltconBSH(), desc);
+                    bold = bnew;
                 }
-                trace(BLT_DEBUG, "    D = %X -> %X\n", dhold, dpt);
-                
-                dpt = U32_ADD(dpt, incr);
-            }
 
-            // Clear the word mask
-            mask = 0xFFFF;
+                // Run the minterm circuit
+                dhold = doMintermLogic(ahold, bhold, chold, bltcon0 & 0xFF);
+
+                // Run the fill logic circuit
+                if (fill) doFill(dhold, fillCarry);
+
+                // Update the zero flag
+                if (dhold) bzero = false;
+
+                // Write D
+                if (useD) {
+                    mem.poke16 <ACCESSOR_AGNUS> (dpt, dhold);
+
+                    if (BLT_CHECKSUM) {
+                        check1 = util::fnvIt32(check1, dhold);
+                        check2 = util::fnvIt32(check2, dpt & agnus.ptrMask);
+                    }
+                    trace(BLT_DEBUG, "    D = %X -> %X\n", dhold, dpt);
+
+                    dpt = U32_ADD(dpt, incr);
+                }
+            }
         }
 
         // Add modulo values
@@ -175,6 +184,127 @@ void Blitter::doFastCopyBlit()
     bltdpt = dpt;
 }
 
+template <bool useA, bool useB, bool useC, bool useD, bool desc>
+bool Blitter::doFastCopyChunk(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt,
+                              isize count, u16 fwm, u16 lwm,
+                              bool fill, bool &fillCarry)
+{
+    assert(count >= 1 && count <= fastChunkSize);
+
+    // Stick to the word-by-word loop if debugging is enabled
+    if (BLT_DEBUG || BLT_CHECKSUM) return false;
+
+    constexpr isize incr = desc ? -2 : 2;
+    const isize span = incr * (count - 1);
+
+    // Translates a DMA pointer into a Chip Ram pointer if the chunk fits in
+    auto resolve = [&](u32 pt) -> u8 * {
+
+        i64 first = pt & agnus.ptrMask;
+        i64 last = first + span;
+        return std::max(first, last) <= mem.chipMask ? mem.chip + first : nullptr;
+    };
+
+    // Checks if a word written to D would be read back later in the chunk
+    auto collides = [&](u32 pt) {
+
+        i64 delta = i64(dpt & agnus.ptrMask) - i64(pt & agnus.ptrMask);
+        return desc ? (delta < 0 && delta >= span) : (delta > 0 && delta <= span);
+    };
+
+    u8 *ap = useA ? resolve(apt) : nullptr;
+    u8 *bp = useB ? resolve(bpt) : nullptr;
+    u8 *cp = useC ? resolve(cpt) : nullptr;
+    u8 *dp = useD ? resolve(dpt) : nullptr;
+
+    if ((useA && !ap) || (useB && !bp) || (useC && !cp) || (useD && !dp)) return false;
+    if (useD && ((useA && collides(apt)) || (useB && collides(bpt)) || (useC && collides(cpt)))) return false;
+
+    /* The barrel shifters and the minterm circuit are run across the full
+     * buffers, no matter how many words are actually in use. The fixed trip
+     * count enables the compiler to vectorize these loops. Index 0 of the A
+     * and B buffers holds the last word of the previous chunk.
+     */
+    u16 a[fastChunkSize + 1] = {}, b[fastChunkSize + 1] = {}, c[fastChunkSize] = {};
+    u16 ah[fastChunkSize], bh[fastChunkSize], d[fastChunkSize];
+
+    // Fetch A, B, and C
+    a[0] = aold;
+    b[0] = bold;
+    for (isize i = 0; i < count; i++) {
+
+        a[i + 1] = useA ? R16BE_ALIGNED(ap + incr * i) : anew;
+        b[i + 1] = useB ? R16BE_ALIGNED(bp + incr * i) : bnew;
+        c[i] = useC ? R16BE_ALIGNED(cp + incr * i) : chold;
+    }
+    if (useA) anew = a[count];
+    if (useB) bnew = b[count];
+
+    // Apply the word masks
+    a[1] &= fwm;
+    a[count] &= lwm;
+
+    // Run the barrel shifters
+    u32 ash = desc ? 16 - bltconASH() : bltconASH();
+    u32 bsh = desc ? 16 - bltconBSH() : bltconBSH();
+
+    for (isize i = 0; i < fastChunkSize; i++) {
+
+        ah[i] = desc ?
+        u16((u32(a[i + 1]) << 16 | a[i]) >> ash) : u16((u32(a[i]) << 16 | a[i + 1]) >> ash);
+    }
+    for (isize i = 0; i < fastChunkSize; i++) {
+
+        bh[i] = !useB ? bhold : desc ?
+        u16((u32(b[i + 1]) << 16 | b[i]) >> bsh) : u16((u32(b[i]) << 16 | b[i + 1]) >> bsh);
+    }
+    aold = a[count];
+    ahold = ah[count - 1];
+    if (useB) { bold = b[count]; bhold = bh[count - 1]; }
+    if (useC) chold = c[count - 1];
+
+    // Run the minterm circuit (in a branch-free way)
+    u8 minterm = bltcon0 & 0xFF;
+    u16 m[8];
+    for (isize i = 0; i < 8; i++) m[i] = GET_BIT(minterm, i) ? 0xFFFF : 0;
+
+    for (isize i = 0; i < fastChunkSize; i++) {
+
+        u16 x = ah[i], y = bh[i], z = c[i];
+        d[i] =
+        (m[7] &  x &  y &  z) | (m[6] &  x &  y & ~z) |
+        (m[5] &  x & ~y &  z) | (m[4] &  x & ~y & ~z) |
+        (m[3] & ~x &  y &  z) | (m[2] & ~x &  y & ~z) |
+        (m[1] & ~x & ~y &  z) | (m[0] & ~x & ~y & ~z);
+    }
+
+    // Run the fill logic circuit
+    if (fill) for (isize i = 0; i < count; i++) doFill(d[i], fillCarry);
+
+    // Update the zero flag
+    u16 any = 0;
+    for (isize i = 0; i < count; i++) any |= d[i];
+    if (any) bzero = false;
+    dhold = d[count - 1];
+
+    // Write D
+    if (useD) for (isize i = 0; i < count; i++) W16BE_ALIGNED(dp + incr * i, d[i]);
+
+    // Emulate the data bus value of the last memory access
+    if (useD) mem.dataBus = dhold;
+    else if (useC) mem.dataBus = chold;
+    else if (useB) mem.dataBus = bnew;
+    else if (useA) mem.dataBus = anew;
+
+    // Advance the pointers
+    if (useA) apt = U32_ADD(apt, incr * count);
+    if (useB) bpt = U32_ADD(bpt, incr * count);
+    if (useC) cpt = U32_ADD(cpt, incr * count);
+    if (useD) dpt = U32_ADD(dpt, incr * count);
+
+    return true;
+}
+
 void
 Blitter::doFastLineBlit()
 {
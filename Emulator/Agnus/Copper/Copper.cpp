@@ -103,44 +103,59 @@ Copper::findMatchOld(Beam &match) const
 bool
 Copper::findMatch(Beam &match) const
 {
-    // Start searching at the current beam position
-    u32 beam = (u32)(agnus.pos.v << 8 | agnus.pos.h);
-
     // Get the comparison position and the comparison mask
     u32 comp = getVPHP();
     u32 mask = getVMHM();
 
-    // Iterate through all lines starting from the current position
+    // Extract the vertical components
+    u32 vcomp = HI_BYTE(comp & mask);
+    u32 vmask = HI_BYTE(mask);
+
+    isize v = agnus.pos.v;
     isize numLines = agnus.frame.numLines();
-    while ((isize)(beam >> 8) < numLines) {
+    if (v >= numLines) return false;
 
-        // Check if the vertical components are equal
-        if ((beam & mask & ~0xFF) == (comp & mask & ~0xFF)) {
+    // Check the current line
+    u32 vbeam = v & vmask;
 
-            // Try to match the horizontal coordinate as well
-            if (findHorizontalMatch(beam, comp, mask)) {
+    if (vbeam > vcomp) {
 
-                // Success
-                match.v = beam >> 8;
-                match.h = beam & 0xFF;
-                return true;
-            }
-        }
+        match.v = v;
+        match.h = agnus.pos.h;
+        return true;
+    }
+    if (vbeam == vcomp) {
 
-        // Check if the vertical beam position is greater
-        else if ((beam & mask & ~0xFF) > (comp & mask & ~0xFF)) {
+        u32 beam = (u32)(v << 8 | agnus.pos.h);
+        if (findHorizontalMatch(beam, comp, mask)) {
 
-            // Success
-            match.v = beam >> 8;
+            match.v = v;
             match.h = beam & 0xFF;
             return true;
         }
+    }
 
-        // Jump to the beginning of the next line
-        beam = (beam & ~0xFF) + 0x100;
+    /* All other lines are entered at position 0. Hence, the result of the
+     * horizontal comparison is the same for all of them. A line matches if
+     * its vertical position is greater than the comparison value or if it
+     * is equal and the horizontal comparison succeeds.
+     */
+    u32 hbeam = 0;
+    bool hmatch = findHorizontalMatch(hbeam, comp, mask);
+    u32 vmin = hmatch ? vcomp : vcomp + 1;
+
+    // Only the lower eight bits of the vertical position are compared
+    isize line = nextMatch(v + 1, std::min(numLines - 1, isize(0xFF)), vmask, vmin);
+    if (line < 0) {
+
+        line = nextMatch(std::max(v + 1, isize(0x100)) - 0x100, numLines - 1 - 0x100, vmask, vmin);
+        if (line >= 0) line += 0x100;
     }
+    if (line < 0) return false;
 
-    return false;
+    match.v = line;
+    match.h = (line & vmask) > vcomp ? 0 : hbeam & 0xFF;
+    return true;
 }
 
 bool
@@ -169,32 +184,72 @@ Copper::findHorizontalMatch(u32 &match, u32 comp, u32 mask) const
 {
     u32 v = match & 0x1FF00;
     u32 h = match & 0x000FF;
-        
-    // Iterate through all horizontal positions execept the last three
-    for (auto i = h + 2; i <= 0xE1; i++, h++) {
 
-        // Check if the comparator triggers at this position
-        if (((v | i) & mask) >= (comp & mask)) {
+    // The comparator is fed with the horizontal position plus two
+    auto i = nextMatch(h + 2, 0xE1, mask & 0xFF, comp & mask & 0xFF);
+    if (i >= 0) {
 
-            match = v | h;
-            return true;
-        }
+        match = v | (u32)(i - 2);
+        return true;
     }
-    
-    // Iterate through the last three cycles with a wrapped over counter
-    for (auto i = 0; i <= 2; i++, h++) {
 
-        // Check if the comparator triggers at this position
-        if (((v | i) & mask) >= (comp & mask)) {
+    // The last three cycles are compared with a wrapped over counter
+    i = nextMatch(0, 2, mask & 0xFF, comp & mask & 0xFF);
+    if (i >= 0) {
 
-            match = v | h;
-            return true;
-        }
+        match = v | (std::max(h, 0xE0U) + (u32)i);
+        return true;
     }
 
     return false;
 }
 
+isize
+Copper::nextMatch(isize lo, isize hi, u32 mask, u32 comp)
+{
+    // Returns the smallest submask of 'm' which is greater or equal to 'c'
+    auto nextSubmask = [](u32 m, u32 c) -> isize {
+
+        if ((c & ~m) == 0) return c;
+
+        for (u32 bit = 1; bit <= m; bit <<= 1) {
+
+            // Set a zero bit of 'c' and clear all bits below
+            if ((c & bit) || !(m & bit)) continue;
+            u32 prefix = c & ~((bit << 1) - 1);
+            if ((prefix & ~m) == 0) return prefix | bit;
+        }
+        return -1;
+    };
+
+    if (lo > hi) return -1;
+    if (((u32)lo & mask) >= comp) return lo;
+
+    /* Any larger value agrees with 'lo' in all bits above a certain position
+     * where 'lo' has a zero bit and the larger value a one bit. We check
+     * these positions from the lowest to the highest, which means that the
+     * first hit is the smallest one.
+     */
+    for (u32 bit = 1; bit <= (u32)hi; bit <<= 1) {
+
+        if ((u32)lo & bit) continue;
+
+        u32 low = bit - 1;
+        u32 prefix = ((u32)lo & ~low) | bit;
+        if (prefix > (u32)hi) break;
+
+        // Compare the bits above the lower part
+        u32 high = prefix & mask;
+        if (high > (comp & ~low)) return prefix;
+        if (high < (comp & ~low)) continue;
+
+        // Choose the smallest lower part satisfying the comparison
+        auto rest = nextSubmask(mask & low, comp & low);
+        if (rest >= 0) return (prefix | (u32)rest) <= (u32)hi ? prefix | rest : -1;
+    }
+    return -1;
+}
+
 void
 Copper::move(u32 addr, u16 value)
 {
@@ -219,6 +274,153 @@ Copper::move(u32 addr, u16 value)
     agnus.doCopperDmaWrite(addr, value);
 }
 
+void
+Copper::runColorMoves()
+{
+    auto &sequencer = agnus.sequencer;
+
+    /* Determine the next cycle where the Copper might be affected by another
+     * component. Bitplane DMA and disk, audio, sprite DMA are not considered
+     * here, because the occupied bus cycles can be looked up in the sequencer
+     * tables. These tables only change when a register change is processed
+     * or when the HSYNC handler is executed. The CPU is not considered either.
+     * It catches up with the run before each bus access and cancels the run
+     * if it interferes (see cancelRun()).
+     */
+    Cycle limit = agnus.trigger[SLOT_REG];
+    if (agnus.trigger[SLOT_BLT] < limit) limit = agnus.trigger[SLOT_BLT];
+    if (agnus.trigger[SLOT_VBL] < limit) limit = agnus.trigger[SLOT_VBL];
+    if (agnus.trigger[SLOT_RAS] < limit) limit = agnus.trigger[SLOT_RAS];
+
+    // Checks if Agnus performs bitplane or DAS DMA in a certain cycle
+    auto dmaCycle = [&](isize h) {
+        auto bpl = sequencer.bplEvent[h] & ~DRAW_BOTH;
+        auto das = sequencer.dasEvent[h];
+        return bpl != EVENT_NONE || (das != EVENT_NONE && das < DAS_SDMA);
+    };
+
+    isize h = agnus.pos.h;
+    u32 pc = coppc;
+
+    while (true) {
+
+        // Compute the bus cycles of the next FETCH and the next MOVE
+        isize fetch = h + 2;
+        isize exec = h + 4;
+
+        // Stay in the current rasterline and don't touch cycle E0
+        if (exec >= HPOS_MAX || fetch == 0xE0 || exec == 0xE0) break;
+
+        // Stop if another component may interfere before the MOVE completes
+        if (agnus.clock + DMA_CYCLES(exec - agnus.pos.h) >= limit) break;
+
+        // Stop if one of the bus cycles is already in use
+        if (agnus.busOwner[fetch] != BUS_NONE || agnus.busOwner[exec] != BUS_NONE) break;
+
+        /* Stop if any other DMA takes place up to the MOVE. Such an access
+         * would leave a different value on the data bus than the event-driven
+         * path does.
+         */
+        bool blocked = false;
+        for (isize i = h + 1; i <= exec; i++) blocked |= dmaCycle(i);
+        if (blocked) break;
+
+        // Stop if the next instruction is not a MOVE to a color register
+        u16 ins = mem.spypeek16 <ACCESSOR_AGNUS> (pc);
+        u16 reg = ins & 0x1FE;
+        if ((ins & 1) || reg < 0x180 || reg > 0x1BE) break;
+
+        pc += 4;
+        h = exec;
+    }
+
+    // Replace the pending COP_FETCH event by a single event for the whole run
+    if (h != agnus.pos.h) {
+
+        runPos = agnus.pos.h + 2;
+        runEnd = h;
+        agnus.scheduleAbs<SLOT_COP>(agnus.clock + DMA_CYCLES(h - agnus.pos.h), COP_RUN);
+    }
+}
+
+bool
+Copper::commitRun(isize h)
+{
+    while (runEnd && runPos <= h) {
+
+        if ((runEnd - runPos) & 2) {
+
+            // Fetch the instruction
+            coppc0 = coppc;
+            cop1ins = agnus.doCopperDmaRead(coppc, runPos);
+            advancePC();
+
+            if (COP_CHECKSUM) {
+                checkcnt++;
+                checksum = util::fnvIt32(checksum, cop1ins);
+            }
+
+            // Check if the list has been modified behind our back (debugger)
+            u16 reg = cop1ins & 0x1FE;
+            if (!isMoveCmd() || reg < 0x180 || reg > 0x1BE) {
+
+                auto next = isMoveCmd() ? COP_MOVE : COP_WAIT_OR_SKIP;
+                agnus.scheduleAbs<SLOT_COP>(agnus.clock + DMA_CYCLES(runPos + 2 - agnus.pos.h), next);
+                runPos = runEnd = 0;
+                return false;
+            }
+
+        } else {
+
+            // Execute the instruction
+            cop2ins = agnus.doCopperDmaRead(coppc, runPos);
+            advancePC();
+
+            if (COP_CHECKSUM) checksum = util::fnvIt32(checksum, cop2ins);
+
+            u16 reg = cop1ins & 0x1FE;
+            trace(COP_DEBUG,
+                  "COPPC: %X move(%s, $%X) (%d)\n", coppc0, Memory::regName(reg), cop2ins, cop2ins);
+
+            pixelEngine.colChanges.insert(4 * runPos, RegChange { reg, cop2ins } );
+        }
+
+        if (runPos == runEnd) {
+            runPos = runEnd = 0;
+        } else {
+            runPos += 2;
+        }
+    }
+
+    return true;
+}
+
+void
+Copper::catchUp()
+{
+    if (runEnd) commitRun(agnus.pos.h - 1);
+}
+
+void
+Copper::handBackRun()
+{
+    assert(runPos >= agnus.pos.h && runPos <= runEnd);
+
+    // Continue with the next bus access of the run
+    auto next = (runEnd - runPos) & 2 ? COP_FETCH : COP_MOVE;
+    agnus.scheduleAbs<SLOT_COP>(agnus.clock + DMA_CYCLES(runPos - agnus.pos.h), next);
+    runPos = runEnd = 0;
+}
+
+bool
+Copper::runFetches(u32 addr) const
+{
+    // Determine the number of instruction words that haven't been fetched
+    u32 count = u32((runEnd - runPos) / 2 + 1);
+
+    return ((addr - coppc) & mem.chipMask) < 2 * count;
+}
+
 bool
 Copper::runComparator() const
 {
@@ -31,6 +31,7 @@ private:
     
     // Result of the latest inspection
     mutable CopperInfo info = {};
+    mutable util::Seqlock<CopperInfo> publishedInfo;
     
     // The currently executed Copper list (1 or 2)
     isize copList = 1;
@@ -57,6 +58,13 @@ private:
 
     // The Copper program counter at the time of the latest FETCH
     u32 coppc0 = 0;
+
+    /* Pending run of color register MOVEs (see runColorMoves()). Variable
+     * runPos is the DMA cycle of the next bus access of the run and runEnd
+     * the DMA cycle of its last MOVE. Both are 0 if no run is pending.
+     */
+    isize runPos = 0;
+    isize runEnd = 0;
     
     /* Indicates whether the Copper has been active since the last vertical
      * sync. The value of this variable is used to determine if a write to the
@@ -132,6 +140,8 @@ private:
         << cop2ins
         << coppc
         << coppc0
+        << runPos
+        << runEnd
         << activeInThisFrame;
     }
 
@@ -148,7 +158,7 @@ private:
 public:
     
     // Returns the result of the latest inspection
-    CopperInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    CopperInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
 
     //
@@ -203,9 +213,58 @@ private:
     bool findHorizontalMatchOld(u32 &beam, u32 comp, u32 mask) const; // DEPRECATED
     bool findHorizontalMatch(u32 &beam, u32 comp, u32 mask) const;
 
+    /* Returns the smallest value x in [lo; hi] satisfying (x & mask) >= comp
+     * or -1 if no such value exists. The result is computed bit by bit. It
+     * is utilized by findMatch() to compute trigger positions in O(1).
+     */
+    static isize nextMatch(isize lo, isize hi, u32 mask, u32 comp);
+
     // Emulates the Copper writing a value into one of the custom registers
     void move(u32 addr, u16 value);
 
+    /* Plans a run of color register MOVEs. This function is called after a
+     * MOVE to a color register has been processed. It collects all subsequent
+     * MOVEs that target color registers as long as their bus cycles are known
+     * to be free, i.e., as long as no other DMA access, event, or register
+     * change is pending in between. Instead of one event per bus access, a
+     * single COP_RUN event is scheduled for the last MOVE. The bus accesses
+     * are carried out lazily by commitRun(), either when the COP_RUN event
+     * fires or when the CPU requests the bus. Each MOVE is carried out in
+     * exactly the same DMA cycles as in the event-driven path.
+     */
+    void runColorMoves();
+
+    /* Carries out all bus accesses of the pending run up to a certain DMA
+     * cycle. Returns false if the run has been handed back to the
+     * event-driven path because the Copper list has changed.
+     */
+    bool commitRun(isize h);
+
+    // Checks if the pending run has yet to fetch the word at a certain address
+    bool runFetches(u32 addr) const;
+
+    // Hands the remaining part of the pending run to the event-driven path
+    void handBackRun();
+
+public:
+
+    /* Cancels the pending run. The first function is called before the CPU
+     * accesses a custom register or writes into Slow RAM. The second function
+     * is called before the CPU writes into Chip RAM. It keeps the run alive
+     * unless the part of the Copper list that hasn't been fetched yet is
+     * affected.
+     */
+    void cancelRun() { if (runEnd) handBackRun(); }
+    void cancelRun(u32 addr) { if (runEnd && runFetches(addr)) handBackRun(); }
+
+    /* Carries out all bus accesses of the pending run that lie behind the
+     * current DMA cycle. This function is called before the CPU reads the
+     * floating data bus.
+     */
+    void catchUp();
+
+private:
+
     // Runs the comparator circuit (DEPRECATED)
     /*
     bool comparator(Beam beam, u16 waitpos, u16 mask) const;
@@ -165,8 +165,27 @@ Copper::serviceEvent(EventID id)
                 amiga.setFlag(RL::COPPERWP_REACHED);
             }
 
+            // Process subsequent color register MOVEs in a single pass
+            if (reg >= 0x180 && reg <= 0x1BE) {
+                if (!checkForBreakpoints && !checkForWatchpoints) runColorMoves();
+            }
+
             break;
             
+        case COP_RUN:
+
+            trace(COP_DEBUG, "COP_RUN\n");
+
+            // Perform all outstanding bus accesses of the run
+            if (!commitRun(agnus.pos.h)) break;
+
+            // Continue with fetching the new command
+            schedule(COP_FETCH);
+
+            // Check if the run can be continued
+            runColorMoves();
+            break;
+
         case COP_WAIT_OR_SKIP:
 
             trace(COP_DEBUG, "COP_WAIT_OR_SKIP\n");
@@ -65,4 +65,6 @@ Copper::_inspect() const
     info.cop2lc = cop2lc & agnus.ptrMask;
     info.cop1ins = cop1ins;
     info.cop2ins = cop2ins;
+
+    publishedInfo.write(info);
 }
@@ -186,6 +186,41 @@ public:
     SigRecorder sigRecorder;
 
     
+    //
+    // Bitplane event table cache
+    //
+    
+private:
+    
+    /* Computing the bitplane event table is costly. Because most programs
+     * switch between a small number of display configurations, recently
+     * computed tables are cached and reused when the same configuration
+     * shows up again. A configuration is identified by the initial state of
+     * the display logic, the scroll values, and all recorded signals.
+     */
+    static constexpr isize bplCacheSize = 16;
+    static constexpr isize bplKeySize = 48;
+
+    struct BplCacheEntry {
+
+        // The configuration the tables have been computed for
+        u16 key[bplKeySize];
+        isize keyLen = 0;
+
+        // The computed tables
+        EventID bplEvent[HPOS_CNT];
+        u8 nextBplEvent[HPOS_CNT];
+
+        // The state of the display logic at the end of the line
+        DDFState state;
+
+        // Indicates if the vertical flipflop has been set in this line
+        bool visible;
+    };
+
+    BplCacheEntry bplCache[bplCacheSize];
+
+    
     //
     // Execution control
     //
@@ -312,6 +347,9 @@ private:
     // Processes a signal change
     template <bool ecs> void processSignal(u16 signal, DDFState &state);
  
+    // Assembles the cache key for the bitplane event table (0 = no fit)
+    isize computeBplKey(const SigRecorder &sr, const DDFState &state, u16 *key) const;
+ 
     // Updates the jump table for the bplEvent table
     void updateBplJumpTable();
 
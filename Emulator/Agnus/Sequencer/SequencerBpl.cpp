@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Sequencer.h"
 #include "Agnus.h"
+#include "Checksum.h"
 
 void
 Sequencer::initBplEvents()
@@ -56,18 +57,53 @@ Sequencer::computeBplEventTable(const SigRecorder &sr)
     // Evaluate the current state of the vertical DIW flipflop
     if (!state.bpv) { state.bprun = false; state.cnt = 0; }
     
-    // Fill the event table
-    if (sr.modified || (state.bpv && state.bmapen) || NO_SEQ_FASTPATH) {
-        computeBplEventsSlow <ecs> (sr, state);
+    // Check if the tables have been computed for this configuration before
+    u16 key[bplKeySize];
+    auto keyLen = computeBplKey(sr, state, key);
+    auto &entry = bplCache[util::fnv32((u8 *)key, 2 * keyLen) % bplCacheSize];
+    
+    if (keyLen && entry.keyLen == keyLen && !memcmp(entry.key, key, 2 * keyLen)) {
+        
+        trace(SEQ_DEBUG, "Cache hit\n");
+
+        std::memcpy(bplEvent, entry.bplEvent, sizeof(bplEvent));
+        std::memcpy(nextBplEvent, entry.nextBplEvent, sizeof(nextBplEvent));
+        state = entry.state;
+        if (entry.visible) lineIsBlank = false;
+        computeFetchUnit(state.bmctl);
+        
     } else {
-        computeBplEventsFast <ecs> (sr, state);
+        
+        auto wasBlank = lineIsBlank;
+        lineIsBlank = true;
+        
+        // Fill the event table
+        if (sr.modified || (state.bpv && state.bmapen) || NO_SEQ_FASTPATH) {
+            computeBplEventsSlow <ecs> (sr, state);
+        } else {
+            computeBplEventsFast <ecs> (sr, state);
+        }
+        
+        auto visible = !lineIsBlank;
+        lineIsBlank = wasBlank && !visible;
+        
+        // Add the EOL event (end of line)
+        bplEvent[HPOS_MAX] |= BPL_EOL;
+        
+        // Update the jump table
+        updateBplJumpTable();
+        
+        // Cache the result
+        if (keyLen) {
+            
+            std::memcpy(entry.key, key, 2 * keyLen);
+            std::memcpy(entry.bplEvent, bplEvent, sizeof(bplEvent));
+            std::memcpy(entry.nextBplEvent, nextBplEvent, sizeof(nextBplEvent));
+            entry.keyLen = keyLen;
+            entry.state = state;
+            entry.visible = visible;
+        }
     }
-    
-    // Add the EOL event (end of line)
-    bplEvent[HPOS_MAX] |= BPL_EOL;
-                            
-    // Update the jump table
-    updateBplJumpTable();
 
     // Rectify the scheduled event
     agnus.scheduleBplEventForCycle(agnus.pos.h);
@@ -83,6 +119,38 @@ Sequencer::computeBplEventTable(const SigRecorder &sr)
     }
 }
 
+isize
+Sequencer::computeBplKey(const SigRecorder &sr, const DDFState &state, u16 *key) const
+{
+    isize len = 0;
+    
+    key[len++] = u16(agnus.isECS()      << 0 |
+                     sr.modified        << 1 |
+                     state.bpv          << 2 |
+                     state.bmapen       << 3 |
+                     state.shw          << 4 |
+                     state.rhw          << 5 |
+                     state.bphstart     << 6 |
+                     state.bphstop      << 7 |
+                     state.bprun        << 8 |
+                     state.lastFu       << 9);
+    key[len++] = HI_LO(state.cnt, state.bmctl);
+    key[len++] = HI_LO(u8(agnus.scrollEven), u8(agnus.scrollOdd));
+    
+    // Append all signals up to the DONE signal
+    for (isize i = 0; i < sr.count(); i++) {
+        
+        if (len + 2 > bplKeySize) return 0;
+        
+        key[len++] = u16(sr.keys[i]);
+        key[len++] = sr.elements[i];
+        
+        if (sr.elements[i] & SIG_DONE) return len;
+    }
+    
+    return 0;
+}
+
 template <bool ecs> void
 Sequencer::computeBplEventsFast(const SigRecorder &sr, DDFState &state)
 {
@@ -90,7 +90,9 @@ Amiga::Amiga()
         &remoteManager,
         &retroShell,
         &regressionTester,
-        &msgQueue
+        &inputRecorder,
+        &msgQueue,
+        &cmdQueue
     };
 
     // Set up the initial state
@@ -277,6 +279,11 @@ Amiga::getConfigItem(Option option) const
         case OPT_DIAG_BOARD:
             
             return diagBoard.getConfigItem(option);
+
+        case OPT_REC_QUEUE_DEPTH:
+        case OPT_REC_DROP_FRAMES:
+
+            return denise.screenRecorder.getConfigItem(option);
             
         default:
             fatalError;
@@ -534,6 +541,12 @@ Amiga::configure(Option option, i64 value)
             diagBoard.setConfigItem(OPT_DIAG_BOARD, value);
             break;
             
+        case OPT_REC_QUEUE_DEPTH:
+        case OPT_REC_DROP_FRAMES:
+
+            denise.screenRecorder.setConfigItem(option, value);
+            break;
+
         case OPT_SRV_PORT:
         case OPT_SRV_PROTOCOL:
         case OPT_SRV_AUTORUN:
@@ -773,6 +786,8 @@ Amiga::_inspect() const
         info.frame = agnus.frame.nr;
         info.vpos = agnus.pos.v;
         info.hpos = agnus.pos.h;
+
+        publishedInfo.write(info);
     }
 }
 
@@ -849,6 +864,9 @@ Amiga::_pause()
 {
     debug(RUN_DEBUG, "_pause\n");
 
+    // Don't leave any commands behind in the queue
+    processCommands();
+
     remoteManager.gdbServer.breakpointReached();
     inspect();
     msgQueue.put(MSG_PAUSE);
@@ -915,6 +933,9 @@ Amiga::save(u8 *buffer)
 void
 Amiga::execute()
 {    
+    // Process all commands that have been issued since the last frame
+    if (!cmdQueue.isEmpty()) processCommands();
+
     while(1) {
         
         // Emulate the next CPU instruction
@@ -1025,6 +1046,13 @@ Amiga::execute()
                 AmigaComponent::warpOff();
             }
             
+            // Are we requested to change the thread state?
+            if (flags & RL::CHANGE_REQUEST) {
+                clearFlag(RL::CHANGE_REQUEST);
+                if (!cmdQueue.isEmpty()) processCommands();
+                if (!serviceChangeRequest()) break;
+            }
+
             // Are we requested to synchronize the thread?
             if (flags & RL::SYNC_THREAD) {
                 clearFlag(RL::SYNC_THREAD);
@@ -1076,6 +1104,147 @@ Amiga::stepOver()
     msgQueue.put(MSG_STEP);
 }
 
+void
+Amiga::executeFrames(isize count)
+{
+    if (isPoweredOff()) throw VAError(ERROR_POWERED_OFF);
+    if (isRunning()) throw VAError(ERROR_RUNNING);
+
+    // State changes are serviced by the thread. Discard outdated requests
+    clearFlag(RL::CHANGE_REQUEST);
+
+    for (isize i = 0; i < count; i++) {
+
+        auto frame = agnus.frame.nr;
+
+        // Run the emulator until the end of the current frame is reached
+        execute();
+
+        // Stop if the frame has been interrupted, e.g., by a breakpoint
+        if (agnus.frame.nr == frame) break;
+    }
+}
+
+void
+Amiga::put(const Cmd &cmd)
+{
+    if (isRunning() && !isEmulatorThread()) {
+
+        // Let the emulator thread process the command
+        if (cmdQueue.put(cmd)) {
+
+            // Process the command in place if the emulator has stopped meanwhile
+            if (!isRunning()) processCommands();
+            return;
+        }
+
+        // The queue is full. Process the command in place
+        SUSPENDED
+        processCommands();
+        processCommand(cmd);
+
+    } else {
+
+        // Process the command immediately (pending commands first)
+        processCommands();
+        processCommand(cmd);
+    }
+}
+
+bool
+Amiga::forward(const Cmd &cmd)
+{
+    if (isRunning() && !isEmulatorThread()) { put(cmd); return true; }
+    return false;
+}
+
+void
+Amiga::processCommands()
+{
+    Cmd cmd;
+    while (cmdQueue.poll(cmd)) processCommand(cmd);
+}
+
+void
+Amiga::processCommand(const Cmd &cmd)
+{
+    debug(QUEUE_DEBUG, "processCommand(%s)\n", CmdTypeEnum::key(cmd.type));
+
+    // Returns the control port addressed by a port command
+    auto port = [&]() -> ControlPort & {
+        return cmd.port.port == PORT_2 ? controlPort2 : controlPort1;
+    };
+
+    try {
+
+        switch (cmd.type) {
+
+            case CMD_CONFIG:
+
+                if (cmd.config.id < 0) {
+                    configure(cmd.config.option, cmd.config.value);
+                } else {
+                    configure(cmd.config.option, cmd.config.id, cmd.config.value);
+                }
+                break;
+
+            case CMD_KEY_PRESS:
+
+                keyboard.pressKey(cmd.key.keycode);
+                break;
+
+            case CMD_KEY_RELEASE:
+
+                keyboard.releaseKey(cmd.key.keycode);
+                break;
+
+            case CMD_KEY_RELEASE_ALL:
+
+                keyboard.releaseAllKeys();
+                break;
+
+            case CMD_MOUSE_MOVE_ABS:
+
+                port().mouse.setXY(cmd.port.x, cmd.port.y);
+                break;
+
+            case CMD_MOUSE_MOVE_REL:
+
+                port().mouse.setDxDy(cmd.port.x, cmd.port.y);
+                break;
+
+            case CMD_MOUSE_EVENT:
+
+                port().mouse.trigger(cmd.port.action);
+                break;
+
+            case CMD_JOY_EVENT:
+
+                port().joystick.trigger(cmd.port.action);
+                break;
+
+            case CMD_DSK_INSERT:
+            {
+                // Get ownership of the disk
+                auto disk = std::unique_ptr<FloppyDisk>((FloppyDisk *)cmd.disk.disk);
+                df[cmd.disk.drive]->insertDisk(std::move(disk), cmd.disk.delay);
+                break;
+            }
+            case CMD_DSK_EJECT:
+
+                df[cmd.disk.drive]->ejectDisk(cmd.disk.delay);
+                break;
+
+            default:
+                fatalError;
+        }
+
+    } catch (VAError &error) {
+
+        warn("%s: %s\n", CmdTypeEnum::key(cmd.type), error.what());
+    }
+}
+
 void
 Amiga::requestAutoSnapshot()
 {
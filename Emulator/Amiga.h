@@ -13,11 +13,13 @@
 #include "Agnus.h"
 #include "ControlPort.h"
 #include "CIA.h"
+#include "CmdQueue.h"
 #include "CPU.h"
 #include "Denise.h"
 #include "FloppyDrive.h"
 #include "GdbServer.h"
 #include "HardDrive.h"
+#include "InputRecorder.h"
 #include "Keyboard.h"
 #include "Memory.h"
 #include "MsgQueue.h"
@@ -42,6 +44,8 @@
  */
 class Amiga : public Thread {
 
+    friend class InputRecorder;
+
     /* Result of the latest inspection. In order to update the GUI inspector
      * panels, the emulator schedules events in the inspector slot (SLOT_INS in
      * the secondary table) on a periodic basis. Inside the event handler, the
@@ -49,6 +53,7 @@ class Amiga : public Thread {
      * displays the result of the latest inspection.
      */
     mutable AmigaInfo info = {};
+    mutable util::Seqlock<AmigaInfo> publishedInfo;
 
      
     //
@@ -101,14 +106,16 @@ public:
     HardDrive *hd[4] = { &hd0, &hd1, &hd2, &hd3 };
     HdController *hdcon[4] = { &hd0con, &hd1con, &hd2con, &hd3con };
 
-    // Gateway to the GUI
+    // Gateways to the GUI
     MsgQueue msgQueue = MsgQueue(*this);
+    CmdQueue cmdQueue = CmdQueue(*this);
 
     // Misc
     RetroShell retroShell = RetroShell(*this);
     RemoteManager remoteManager = RemoteManager(*this);
     OSDebugger osDebugger = OSDebugger(*this);
     RegressionTester regressionTester = RegressionTester(*this);
+    InputRecorder inputRecorder = InputRecorder(*this);
     
     
     //
@@ -229,6 +236,7 @@ private:
 private:
     
     void execute() override;
+    void signalChange() override { setFlag(RL::CHANGE_REQUEST); }
 
     
     //
@@ -263,7 +271,7 @@ private:
     
 public:
     
-    AmigaInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    AmigaInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
     
     InspectionTarget getInspectionTarget() const;
     void setInspectionTarget(InspectionTarget target, Cycle trigger = 0);
@@ -305,8 +313,46 @@ public:
      * length bytes of the current instruction and starts the emulator thread.
      */
     void stepOver();
+
+    /* Emulates the specified number of frames on the calling thread. This
+     * function is intended for external drivers that need to step the
+     * emulator in lock-step, such as the control server of the headless app.
+     * It must only be called while the emulator is paused. Execution stops
+     * early if a breakpoint or a similar event interrupts the current frame.
+     */
+    void executeFrames(isize count) throws;
         
     
+    //
+    // Processing commands
+    //
+    
+public:
+    
+    /* Passes a command to the emulator. If the emulator is running, the
+     * command is put into the command queue and the function returns right
+     * away. The emulator thread processes all pending commands at the next
+     * frame boundary, before it gets suspended, and when it gets paused.
+     * Otherwise, the command is processed immediately.
+     */
+    void put(const Cmd &cmd);
+
+    /* Forwards a command to the command queue if the emulator is running and
+     * the function is called from a foreign thread. Input handlers call this
+     * function first. This way, all inputs are applied by the emulator thread
+     * at a well-defined cycle. Returns true if the command has been forwarded.
+     */
+    bool forward(const Cmd &cmd);
+    
+private:
+    
+    // Processes all pending commands
+    void processCommands();
+    
+    // Processes a single command
+    void processCommand(const Cmd &cmd);
+    
+    
     //
     // Handling snapshots
     //
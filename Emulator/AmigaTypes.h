@@ -292,6 +292,7 @@ constexpr u32 COPPERWP_REACHED   = (1 << 10);
 constexpr u32 AUTO_SNAPSHOT      = (1 << 11);
 constexpr u32 USER_SNAPSHOT      = (1 << 12);
 constexpr u32 SYNC_THREAD        = (1 << 13);
+constexpr u32 CHANGE_REQUEST     = (1 << 14);
 };
 
 #endif
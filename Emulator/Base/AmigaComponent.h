@@ -160,14 +160,18 @@ public:
 
     /* Base method for building the class specific getInfo() methods. When the
      * emulator is running, the result of the most recent inspection is
-     * returned. If the emulator isn't running, the function first updates the
-     * cached values in order to return up-to-date results.
+     * returned. It is taken from a seqlock which is updated at the end of each
+     * inspection. Hence, the caller neither acquires the component's mutex nor
+     * blocks the emulator thread. If the emulator isn't running, the function
+     * first updates the cached values in order to return up-to-date results.
      */
-    template<class T> T getInfo(T &cachedValues) const {
+    template<class T> T getInfo(T &cachedValues, const util::Seqlock<T> &published) const {
         
+        if (isRunning()) return published.read();
+
         {   SYNCHRONIZED
             
-            if (!isRunning()) inspect();
+            inspect();
             return cachedValues;
         }
     }
@@ -125,6 +125,10 @@ enum_long(OPT)
     // Expansion boards
     OPT_DIAG_BOARD,
     
+    // Screen recorder
+    OPT_REC_QUEUE_DEPTH,
+    OPT_REC_DROP_FRAMES,
+
     // Remote servers
     OPT_SRV_PORT,
     OPT_SRV_PROTOCOL,
@@ -233,6 +237,9 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
 
             case OPT_DIAG_BOARD:            return "DIAG_BOARD";
 
+            case OPT_REC_QUEUE_DEPTH:       return "REC_QUEUE_DEPTH";
+            case OPT_REC_DROP_FRAMES:       return "REC_DROP_FRAMES";
+
             case OPT_SRV_PORT:              return "SRV_PORT";
             case OPT_SRV_PROTOCOL:          return "SRV_PROTOCOL";
             case OPT_SRV_AUTORUN:           return "SRV_AUTORUN";
@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "CmdQueue.h"
+#include "FloppyDisk.h"
+
+CmdQueue::CmdQueue(Amiga& ref) : SubComponent(ref)
+{
+    for (isize i = 0; i < capacity; i++) slots[i].seq.store(i);
+}
+
+CmdQueue::~CmdQueue()
+{
+    Cmd cmd;
+
+    // Free all disks that haven't been handed over to a drive
+    while (poll(cmd)) {
+        if (cmd.type == CMD_DSK_INSERT) delete (FloppyDisk *)cmd.disk.disk;
+    }
+}
+
+bool
+CmdQueue::put(const Cmd &cmd)
+{
+    auto pos = w.load(std::memory_order_relaxed);
+
+    while (true) {
+
+        auto &slot = slots[pos & (capacity - 1)];
+        auto diff = slot.seq.load(std::memory_order_acquire) - pos;
+
+        if (diff == 0) {
+
+            // The slot is free. Try to claim it
+            if (w.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+
+                debug(QUEUE_DEBUG, "put(%s)\n", CmdTypeEnum::key(cmd.type));
+
+                slot.cmd = cmd;
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+        } else if (diff < 0) {
+
+            // The queue is full
+            return false;
+
+        } else {
+
+            // Another producer has claimed the slot in the meantime
+            pos = w.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool
+CmdQueue::poll(Cmd &cmd)
+{
+    auto pos = r.load(std::memory_order_relaxed);
+
+    while (true) {
+
+        auto &slot = slots[pos & (capacity - 1)];
+        auto diff = slot.seq.load(std::memory_order_acquire) - (pos + 1);
+
+        if (diff == 0) {
+
+            // The slot is filled. Try to claim it
+            if (r.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+
+                cmd = slot.cmd;
+                slot.seq.store(pos + capacity, std::memory_order_release);
+                return true;
+            }
+
+        } else if (diff < 0) {
+
+            // The queue is empty
+            return false;
+
+        } else {
+
+            // Another consumer has claimed the slot in the meantime
+            pos = r.load(std::memory_order_relaxed);
+        }
+    }
+}
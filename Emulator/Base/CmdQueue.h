@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "CmdQueueTypes.h"
+#include "SubComponent.h"
+#include <atomic>
+
+/* The command queue hands over requests from the GUI to the emulator thread.
+ * It is implemented as a bounded lock-free ring buffer. Each slot carries a
+ * sequence number telling producers and consumers whether the slot is free or
+ * filled. Hence, commands can be put into the queue and taken out of it from
+ * multiple threads without ever blocking.
+ */
+class CmdQueue : public SubComponent {
+
+    // Number of slots (must be a power of two)
+    static constexpr isize capacity = 256;
+
+    struct Slot {
+
+        std::atomic<isize> seq;
+        Cmd cmd;
+    };
+
+    // The ring buffer
+    Slot slots[capacity];
+
+    // Write and read positions
+    alignas(64) std::atomic<isize> w = 0;
+    alignas(64) std::atomic<isize> r = 0;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    CmdQueue(Amiga& ref);
+    ~CmdQueue();
+
+
+    //
+    // Methods from AmigaObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "CmdQueue"; }
+    void _dump(Category category, std::ostream& os) const override { }
+
+
+    //
+    // Methods from AmigaComponent
+    //
+
+private:
+
+    void _reset(bool hard) override { };
+    isize _size() override { return 0; }
+    u64 _checksum() override { return 0; }
+    isize _load(const u8 *buffer) override { return 0; }
+    isize _save(u8 *buffer) override { return 0; }
+
+
+    //
+    // Managing the queue
+    //
+
+public:
+
+    // Checks if the queue contains pending commands
+    bool isEmpty() const { return r.load() == w.load(); }
+
+    // Adds a command (returns false if the queue is full)
+    bool put(const Cmd &cmd);
+
+    // Removes the oldest command (returns false if the queue is empty)
+    bool poll(Cmd &cmd);
+};
@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+#include "Reflection.h"
+#include "AmigaComponentTypes.h"
+#include "JoystickTypes.h"
+
+enum_long(CMD_TYPE)
+{
+    CMD_NONE = 0,
+
+    // Configuration
+    CMD_CONFIG,
+
+    // Keyboard
+    CMD_KEY_PRESS,
+    CMD_KEY_RELEASE,
+    CMD_KEY_RELEASE_ALL,
+
+    // Mouse
+    CMD_MOUSE_MOVE_ABS,
+    CMD_MOUSE_MOVE_REL,
+    CMD_MOUSE_EVENT,
+
+    // Joystick
+    CMD_JOY_EVENT,
+
+    // Floppy drives
+    CMD_DSK_INSERT,
+    CMD_DSK_EJECT
+};
+typedef CMD_TYPE CmdType;
+
+#ifdef __cplusplus
+struct CmdTypeEnum : util::Reflection<CmdTypeEnum, CmdType>
+{
+    static long minVal() { return 0; }
+    static long maxVal() { return CMD_DSK_EJECT; }
+    static bool isValid(auto val) { return val >= minVal() && val <= maxVal(); }
+
+    static const char *prefix() { return "CMD"; }
+    static const char *key(CmdType value)
+    {
+        switch (value) {
+
+            case CMD_NONE:                  return "NONE";
+
+            case CMD_CONFIG:                return "CONFIG";
+
+            case CMD_KEY_PRESS:             return "KEY_PRESS";
+            case CMD_KEY_RELEASE:           return "KEY_RELEASE";
+            case CMD_KEY_RELEASE_ALL:       return "KEY_RELEASE_ALL";
+
+            case CMD_MOUSE_MOVE_ABS:        return "MOUSE_MOVE_ABS";
+            case CMD_MOUSE_MOVE_REL:        return "MOUSE_MOVE_REL";
+            case CMD_MOUSE_EVENT:           return "MOUSE_EVENT";
+
+            case CMD_JOY_EVENT:             return "JOY_EVENT";
+
+            case CMD_DSK_INSERT:            return "DSK_INSERT";
+            case CMD_DSK_EJECT:             return "DSK_EJECT";
+        }
+        return "???";
+    }
+};
+#endif
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    Option option;
+    i64 value;
+
+    // Component id (-1 if the option applies to all components)
+    isize id;
+}
+ConfigCmd;
+
+typedef struct
+{
+    KeyCode keycode;
+}
+KeyCmd;
+
+typedef struct
+{
+    // Control port (1 or 2)
+    isize port;
+
+    // Mouse coordinates (absolute or relative)
+    double x;
+    double y;
+
+    // Game pad action (mouse buttons or joystick)
+    GamePadAction action;
+}
+PortCmd;
+
+typedef struct
+{
+    // Drive number
+    isize drive;
+    Cycle delay;
+
+    // Disk to insert (ownership is passed to the emulator)
+    void *disk;
+}
+DiskCmd;
+
+typedef struct
+{
+    CmdType type;
+
+    union {
+
+        ConfigCmd config;
+        KeyCmd key;
+        PortCmd port;
+        DiskCmd disk;
+    };
+}
+Cmd;
@@ -37,6 +37,7 @@ hd0con(ref.hd0con),
 hd1con(ref.hd1con),
 hd2con(ref.hd2con),
 hd3con(ref.hd3con),
+inputRecorder(ref.inputRecorder),
 keyboard(ref.keyboard),
 mem(ref.mem),
 msgQueue(ref.msgQueue),
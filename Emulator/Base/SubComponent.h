@@ -27,6 +27,7 @@ class DmaDebugger;
 class FloppyDrive;
 class HardDrive;
 class HdController;
+class InputRecorder;
 class GdbServer;
 class Joystick;
 class Keyboard;
@@ -78,6 +79,7 @@ protected:
     HdController &hd1con;
     HdController &hd2con;
     HdController &hd3con;
+    InputRecorder &inputRecorder;
     Keyboard &keyboard;
     Memory &mem;
     MsgQueue &msgQueue;
@@ -52,7 +52,7 @@ Thread::sleep <Thread::SyncMode::Periodic> ()
     auto now = util::Time::now();
 
     // Only proceed if we're not running in warp mode
-    if (warpMode) return;
+    if (warpMode) { interrupted = false; return; }
         
     // Check if we're running too slow...
     if (now > targetTime) {
@@ -80,11 +80,13 @@ Thread::sleep <Thread::SyncMode::Periodic> ()
         }
     }
         
-    // Sleep for a while
-    // std::cout << "Sleeping... " << targetTime.asMilliseconds() << std::endl;
-    // std::cout << "Delay = " << delay.asNanoseconds() << std::endl;
-    targetTime += delay;
-    targetTime.sleepUntil();
+    // Advance the target time unless an interrupted sleep is continued
+    if (!interrupted) targetTime += delay;
+
+    // Sleep until the target time is reached or a change request comes in
+    auto timeout = std::chrono::nanoseconds((targetTime - now).asNanoseconds());
+    std::unique_lock<std::mutex> lock(changeMutex);
+    interrupted = changeCond.wait_for(lock, timeout, [this]() { return changeRequested(); });
 }
 
 template <> void
@@ -92,6 +94,7 @@ Thread::sleep <Thread::SyncMode::Pulsed> ()
 {
     // Wait for the next pulse
     if (!warpMode) waitForWakeUp();
+    interrupted = false;
 }
 
 void
@@ -101,7 +104,8 @@ Thread::main()
           
     while (++loopCounter) {
            
-        if (isRunning()) {
+        // Run the emulator unless the last sleep period has been cut short
+        if (isRunning() && !interrupted) {
                         
             switch (mode) {
                 case SyncMode::Periodic: execute<SyncMode::Periodic>(); break;
@@ -115,21 +119,16 @@ Thread::main()
                 case SyncMode::Periodic: sleep<SyncMode::Periodic>(); break;
                 case SyncMode::Pulsed: sleep<SyncMode::Pulsed>(); break;
             }
+        } else {
+
+            interrupted = false;
         }
         
-        // Are we requested to enter or exit warp mode?
-        if (newWarpMode != warpMode) {
-            
-            AmigaComponent::warpOnOff(newWarpMode);
-            warpMode = newWarpMode;
-        }
+        // Are we requested to stay away from all locks?
+        if (freezeRequest) park();
 
-        // Are we requested to enter or exit warp mode?
-        if (newDebugMode != debugMode) {
-            
-            AmigaComponent::debugOnOff(newDebugMode);
-            debugMode = newDebugMode;
-        }
+        // Are we requested to enter or exit warp mode or debug mode?
+        changeModes();
 
         // Are we requested to change state?
         while (newState != state) {
@@ -137,40 +136,40 @@ Thread::main()
             if (state == EXEC_OFF && newState == EXEC_PAUSED) {
                 
                 AmigaComponent::powerOn();
-                state = EXEC_PAUSED;
+                setState(EXEC_PAUSED);
 
             } else if (state == EXEC_PAUSED && newState == EXEC_OFF) {
                 
                 AmigaComponent::powerOff();
-                state = EXEC_OFF;
+                setState(EXEC_OFF);
             
             } else if (state == EXEC_PAUSED && newState == EXEC_RUNNING) {
                 
                 AmigaComponent::run();
-                state = EXEC_RUNNING;
+                setState(EXEC_RUNNING);
             
             } else if (state == EXEC_RUNNING && newState == EXEC_OFF) {
                 
                 AmigaComponent::pause();
-                state = EXEC_PAUSED;
+                setState(EXEC_PAUSED);
             
             } else if (state == EXEC_RUNNING && newState == EXEC_PAUSED) {
                 
                 AmigaComponent::pause();
-                state = EXEC_PAUSED;
+                setState(EXEC_PAUSED);
 
             } else if (state == EXEC_RUNNING && newState == EXEC_SUSPENDED) {
                 
-                state = EXEC_SUSPENDED;
+                setState(EXEC_SUSPENDED);
 
             } else if (state == EXEC_SUSPENDED && newState == EXEC_RUNNING) {
                 
-                state = EXEC_RUNNING;
+                setState(EXEC_RUNNING);
 
             } else if (newState == EXEC_HALTED) {
                 
                 AmigaComponent::halt();
-                state = EXEC_HALTED;
+                setState(EXEC_HALTED);
                 return;
 
             } else {
@@ -197,6 +196,84 @@ Thread::main()
     }
 }
 
+bool
+Thread::changeRequested() const
+{
+    return newState != state || newWarpMode != warpMode || newDebugMode != debugMode ||
+    freezeRequest;
+}
+
+void
+Thread::changeModes()
+{
+    if (newWarpMode != warpMode) {
+
+        AmigaComponent::warpOnOff(newWarpMode);
+
+        { std::lock_guard<std::mutex> lock(changeMutex); warpMode = newWarpMode; }
+        changeCond.notify_all();
+    }
+
+    if (newDebugMode != debugMode) {
+
+        AmigaComponent::debugOnOff(newDebugMode);
+
+        { std::lock_guard<std::mutex> lock(changeMutex); debugMode = newDebugMode; }
+        changeCond.notify_all();
+    }
+}
+
+void
+Thread::park()
+{
+    std::unique_lock<std::mutex> lock(changeMutex);
+
+    parked = true;
+    changeCond.notify_all();
+    changeCond.wait(lock, [this]() { return !freezeRequest; });
+    parked = false;
+}
+
+void
+Thread::setState(ExecutionState value)
+{
+    { std::lock_guard<std::mutex> lock(changeMutex); state = value; }
+    changeCond.notify_all();
+}
+
+bool
+Thread::serviceChangeRequest()
+{
+    assert(isEmulatorThread());
+
+    // Carry out warp mode and debug mode changes immediately
+    changeModes();
+
+    if (newState == state) return true;
+
+    // All other state changes are carried out outside the execution function
+    if (state != EXEC_RUNNING || newState != EXEC_SUSPENDED) return false;
+
+    debug(RUN_DEBUG, "Suspending in place\n");
+
+    setState(EXEC_SUSPENDED);
+    loadClock.stop();
+    auto start = util::Time::now();
+
+    // Wait until we get resumed
+    {   std::unique_lock<std::mutex> lock(changeMutex);
+        changeCond.wait(lock, [this]() { return newState != EXEC_SUSPENDED; });
+    }
+
+    // Don't let the suspension period count as emulation time
+    targetTime += util::Time::now() - start;
+    loadClock.go();
+    if (newState != EXEC_RUNNING) return false;
+
+    setState(EXEC_RUNNING);
+    return true;
+}
+
 void
 Thread::setSyncDelay(util::Time newDelay)
 {
@@ -329,22 +406,43 @@ Thread::debugOff(isize source)
 void
 Thread::changeStateTo(ExecutionState requestedState, bool blocking)
 {
-    newState = requestedState;
-    if (blocking) while (state != requestedState) { };
+    { std::lock_guard<std::mutex> lock(changeMutex); newState = requestedState; }
+    changeCond.notify_all();
+    signalChange();
+
+    if (blocking) {
+
+        std::unique_lock<std::mutex> lock(changeMutex);
+        changeCond.wait(lock, [&]() { return state == requestedState; });
+    }
 }
 
 void
 Thread::changeWarpTo(u8 value, bool blocking)
 {
-    newWarpMode = value;
-    if (blocking) while (warpMode != newWarpMode) { };
+    { std::lock_guard<std::mutex> lock(changeMutex); newWarpMode = value; }
+    changeCond.notify_all();
+    signalChange();
+
+    if (blocking) {
+
+        std::unique_lock<std::mutex> lock(changeMutex);
+        changeCond.wait(lock, [this]() { return warpMode == newWarpMode; });
+    }
 }
 
 void
 Thread::changeDebugTo(u8 value, bool blocking)
 {
-    newDebugMode = value;
-    if (blocking) while (debugMode != newDebugMode) { };
+    { std::lock_guard<std::mutex> lock(changeMutex); newDebugMode = value; }
+    changeCond.notify_all();
+    signalChange();
+
+    if (blocking) {
+
+        std::unique_lock<std::mutex> lock(changeMutex);
+        changeCond.wait(lock, [this]() { return debugMode == newDebugMode; });
+    }
 }
 
 void
@@ -358,6 +456,9 @@ Thread::suspend()
 {
     debug(RUN_DEBUG, "Suspending (%ld)...\n", suspendCounter);
     
+    // The emulator thread is always in a safe state when calling this function
+    if (isEmulatorThread()) return;
+
     if (suspendCounter || isRunning()) {
 
         suspendCounter++;
@@ -371,6 +472,8 @@ Thread::resume()
 {
     debug(RUN_DEBUG, "Resuming (%ld)...\n", suspendCounter);
 
+    if (isEmulatorThread()) return;
+
     if (suspendCounter && --suspendCounter == 0) {
         
         assert(state == EXEC_SUSPENDED);
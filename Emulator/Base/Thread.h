@@ -13,6 +13,8 @@
 #include "AmigaComponent.h"
 #include "Chrono.h"
 #include "Concurrency.h"
+#include <condition_variable>
+#include <mutex>
 
 /* This class manages the emulator thread that runs side by side with the GUI.
  * The thread exists during the lifetime of the emulator instance, but may not
@@ -93,6 +95,12 @@
  *       do something with the internal state;
  *       resume();
  *
+ * Change requests are handed over to the emulator thread via a condition
+ * variable. The calling thread is put to sleep until the request has been
+ * carried out. If the emulator is running, the request is serviced in between
+ * two CPU instructions. In particular, a suspended emulator thread does not
+ * leave the execution function. It waits for the resume request in place.
+ *
  * It it safe to nest multiple suspend/resume blocks, but it is essential
  * that each call to suspend() is followed by a call to resume(). As a result,
  * the critical code section must not be exited in the middle, e.g., by
@@ -144,6 +152,14 @@ protected:
     volatile u8 debugMode = 0;
     volatile u8 newDebugMode = 0;
 
+    // Synchronization primitives for handing over change requests
+    std::mutex changeMutex;
+    std::condition_variable changeCond;
+
+    // Indicates if the thread is requested to park or has been parked (see freeze())
+    volatile bool freezeRequest = false;
+    bool parked = false;
+
     // Indicates if warp mode or debug mode is locked (DEPRECATED)
     bool warpLock = false;
     bool debugLock = false;
@@ -155,6 +171,9 @@ protected:
     // Time stamps for adjusting the execution speed
     util::Time delay = util::Time(1000000000 / 50);
     util::Time targetTime;
+
+    // Indicates if the last sleep period has been cut short by a change request
+    bool interrupted = false;
             
     // Clocks for measuring the CPU load
     util::Clock nonstopClock;
@@ -191,6 +210,14 @@ private:
     // The code to be executed in each iteration (implemented by the subclass)
     virtual void execute() = 0;
 
+    // Informs the execution function about a change request (implemented by the subclass)
+    virtual void signalChange() = 0;
+
+    // Blocks the thread without holding a lock until the freeze is over
+    void park();
+
+public:
+    
     // Returns true if this functions is called from within the emulator thread
     bool isEmulatorThread() { return std::this_thread::get_id() == thread.get_id(); }
 
@@ -236,6 +263,35 @@ public:
     void pause(bool blocking = true);
     void halt(bool blocking = true);
 
+    /* Executes a function while the emulator thread is parked. The emulator
+     * must neither be running nor suspended. Before the function is called, the emulator thread
+     * is brought to a point where it waits on a condition variable without
+     * holding any lock, including the stdio locks. Note that only the
+     * emulator thread is affected. Other threads such as the remote servers
+     * or the writer thread of the screen recorder keep running. Hence, the
+     * function may only fork the process if these threads are shut down.
+     */
+    template <class F> void freeze(F &&func) {
+        
+        assert(!isRunning() && !isSuspended() && !isEmulatorThread());
+        std::unique_lock<std::mutex> lock(changeMutex);
+
+        // A halted thread has already left its main function
+        if (state != EXEC_HALTED) {
+
+            freezeRequest = true;
+            changeCond.notify_all();
+            wakeUp();
+            changeCond.wait(lock, [this]() { return parked; });
+        }
+
+        try { func(); } catch (...) { freezeRequest = false; throw; }
+
+        freezeRequest = false;
+        lock.unlock();
+        changeCond.notify_all();
+    }
+
     bool inWarpMode() const { return warpMode != 0; }
     void warpOn(isize source = 0);
     void warpOff(isize source = 0);
@@ -249,6 +305,24 @@ protected:
     void changeStateTo(ExecutionState requestedState, bool blocking);
     void changeWarpTo(u8 value, bool blocking = true);
     void changeDebugTo(u8 value, bool blocking = true);
+
+    /* Services pending change requests inside the execution function. Warp
+     * and debug mode changes are carried out right away. A suspend request
+     * blocks the emulator thread until it gets resumed. The function returns
+     * false if the execution function needs to return to complete the request.
+     */
+    bool serviceChangeRequest();
+
+private:
+
+    // Checks if a state, warp mode, or debug mode change has been requested
+    bool changeRequested() const;
+
+    // Carries out pending warp mode and debug mode changes
+    void changeModes();
+
+    // Switches to a new state and informs all waiting threads
+    void setState(ExecutionState newState);
     
     
     //
@@ -161,6 +161,8 @@ CIA::_inspect() const
         info.idleSince = idleSince();
         info.idleTotal = idleTotal();
         info.idlePercentage = clock ? (double)idleCycles / (double)clock : 100.0;
+
+        publishedInfo.write(info);
     }
 }
 
@@ -348,13 +350,30 @@ void
 CIA::executeOneCycle()
 {
     clock += CIA_CYCLES(1);
- 
-    // Make a local copy for speed
-    u64 delay = this->delay;
-    
+
     u64 oldDelay = delay;
     u64 oldFeed  = feed;
-    
+
+    emulateCycle();
+
+    // Get tired if nothing has happened in this cycle
+    if (oldDelay == delay && oldFeed == feed) tiredness++; else tiredness = 0;
+
+    // Sleep if threshold is reached
+    if (tiredness > 8 && !CIA_ON_STEROIDS) {
+        sleep();
+        scheduleWakeUp();
+    } else {
+        scheduleNextExecution();
+    }
+}
+
+void
+CIA::emulateCycle()
+{
+    // Make a local copy for speed
+    u64 delay = this->delay;
+
     //
 	// Layout of timer (A and B)
 	//
@@ -663,20 +682,9 @@ CIA::executeOneCycle()
 
     // Move delay flags left and feed in new bits
     delay = ((delay << 1) & CIADelayMask) | feed;
-    
-    // Get tired if nothing has happened in this cycle
-    if (oldDelay == delay && oldFeed == feed) tiredness++; else tiredness = 0;
-    
+
     // Write back local copy
     this->delay = delay;
-
-    // Sleep if threshold is reached
-    if (tiredness > 8 && !CIA_ON_STEROIDS) {
-        sleep();
-        scheduleWakeUp();
-    } else {
-        scheduleNextExecution();
-    }
 }
 
 void
@@ -690,9 +698,9 @@ CIA::sleep()
     Cycle sleepA = clock + CIA_CYCLES((counterA > 2) ? (counterA - 1) : 0);
     Cycle sleepB = clock + CIA_CYCLES((counterB > 2) ? (counterB - 1) : 0);
     
-    // CIAs with stopped timers can sleep forever
-    if (!(feed & CIACountA0)) sleepA = INT64_MAX;
-    if (!(feed & CIACountB0)) sleepB = INT64_MAX;
+    // CIAs with stopped or silently running timers can sleep forever
+    if (!(feed & CIACountA0) || isSilentA()) sleepA = INT64_MAX;
+    if (!(feed & CIACountB0) || isSilentB()) sleepB = INT64_MAX;
     
     // ZZzzz
     sleepCycle = clock;
@@ -722,24 +730,85 @@ CIA::wakeUp(Cycle targetCycle)
     
     // Make up for missed cycles
     if (missedCycles > 0) {
-        
-        if (feed & CIACountA0) {
-            assert(counterA >= AS_CIA_CYCLES(missedCycles));
-            counterA -= (u16)AS_CIA_CYCLES(missedCycles);
-        }
-        if (feed & CIACountB0) {
-            assert(counterB >= AS_CIA_CYCLES(missedCycles));
-            counterB -= (u16)AS_CIA_CYCLES(missedCycles);
+
+        while (true) {
+
+            // Determine the number of cycles until a silent timer underflows
+            CIACycle missed = AS_CIA_CYCLES(targetCycle - clock);
+            CIACycle next = INT64_MAX;
+            if (isSilentA()) next = std::min(next, CIACycle(counterA));
+            if (isSilentB()) next = std::min(next, CIACycle(counterB));
+            if (next > missed) break;
+
+            // Fast-forward to the cycle right before the underflow
+            skip(next - 1);
+
+            // Emulate the underflow until the timer is running steadily again
+            do {
+                clock += CIA_CYCLES(1);
+                emulateCycle();
+            } while (clock < targetCycle && !isSteady());
         }
-        
-        idleCycles += missedCycles;
-        clock = targetCycle;
+
+        skip(AS_CIA_CYCLES(targetCycle - clock));
     }
     
     // Schedule the next execution event
     scheduleNextExecution();
 }
 
+bool
+CIA::isSilentA() const
+{
+    return
+    (feed & CIACountA0) &&                  // Timer is running
+    !((delay | feed) & CIAOneShotA0) &&     // Continuous mode
+    !(imr & 0x01) &&                        // No interrupt
+    !(cra & 0x42) &&                        // No serial clock, no PB6 out
+    (crb & 0x41) != 0x41;                   // No cascading into timer B
+}
+
+bool
+CIA::isSilentB() const
+{
+    return
+    (feed & CIACountB0) &&                  // Timer is running
+    !((delay | feed) & CIAOneShotB0) &&     // Continuous mode
+    !(imr & 0x02) &&                        // No interrupt
+    !(crb & 0x62);                          // Counting Phi2, no PB7 out
+}
+
+void
+CIA::skip(CIACycle cycles)
+{
+    assert(cycles >= 0);
+
+    if (feed & CIACountA0) {
+        assert(counterA >= cycles);
+        counterA -= (u16)cycles;
+    }
+    if (feed & CIACountB0) {
+        assert(counterB >= cycles);
+        counterB -= (u16)cycles;
+    }
+
+    idleCycles += CIA_CYCLES(cycles);
+    clock += CIA_CYCLES(cycles);
+}
+
+u16
+CIA::spyCounter(u16 counter, u16 latch, bool silent) const
+{
+    CIACycle cycles = idleSince();
+
+    // Without a silent underflow, the counter has simply been decremented
+    if (!silent || cycles < counter) return u16(counter - cycles);
+
+    // Otherwise, the counter has been reloaded periodically
+    auto phase = (cycles - counter) % (CIACycle(latch) + 1);
+    return phase ? u16(latch - (phase - 1)) : latch;
+}
+
 CIACycle
 CIA::idleSince() const
 {
@@ -82,6 +82,7 @@ protected:
 
     // Result of the latest inspection
     mutable CIAInfo info = {};
+    mutable util::Seqlock<CIAInfo> publishedInfo;
 
 
     //
@@ -364,7 +365,7 @@ public:
     
 public:
     
-    CIAInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    CIAInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
     Cycle getClock() const { return clock; }
     
 protected:
@@ -508,7 +509,12 @@ public:
         
     // Executes the CIA for one CIA cycle
     void executeOneCycle();
-    
+
+private:
+
+    // Emulates the timer, serial, and interrupt logic for a single cycle
+    void emulateCycle();
+
     
     //
     // Speeding up (sleep logic)
@@ -518,7 +524,25 @@ private:
     
     // Puts the CIA into idle state
     void sleep();
-    
+
+    /* Checks if a timer underflow has no effect other than reloading the
+     * counter, setting the ICR bit, and flipping the toggle bit. If this is
+     * the case, the CIA doesn't need to wake up for the underflow. It is
+     * reproduced when the CIA wakes up for other reasons, e.g., when the CPU
+     * accesses a register.
+     */
+    bool isSilentA() const;
+    bool isSilentB() const;
+
+    // Checks if the pipeline flags remain unchanged in the next cycle
+    bool isSteady() const { return delay == (((delay << 1) & CIADelayMask) | feed); }
+
+    // Advances the clock by a certain number of cycles without an underflow
+    void skip(CIACycle cycles);
+
+    // Computes the value a sleeping timer has reached in the meantime
+    u16 spyCounter(u16 counter, u16 latch, bool silent) const;
+
 public:
     
     // Emulates all previously skipped cycles
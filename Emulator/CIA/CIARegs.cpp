@@ -161,19 +161,19 @@ CIA::spypeek(u16 addr) const
             
         case 0x04: // CIA_TIMER_A_LOW
             running = delay & CIACountA3;
-            return LO_BYTE(counterA - (running ? (u16)idleSince() : 0));
+            return LO_BYTE(running ? spyCounter(counterA, latchA, isSilentA()) : counterA);
             
         case 0x05: // CIA_TIMER_A_HIGH
             running = delay & CIACountA3;
-            return HI_BYTE(counterA - (running ? (u16)idleSince() : 0));
+            return HI_BYTE(running ? spyCounter(counterA, latchA, isSilentA()) : counterA);
             
         case 0x06: // CIA_TIMER_B_LOW
             running = delay & CIACountB3;
-            return LO_BYTE(counterB - (running ? (u16)idleSince() : 0));
+            return LO_BYTE(running ? spyCounter(counterB, latchB, isSilentB()) : counterB);
             
         case 0x07: // CIA_TIMER_B_HIGH
             running = delay & CIACountB3;
-            return HI_BYTE(counterB - (running ? (u16)idleSince() : 0));
+            return HI_BYTE(running ? spyCounter(counterB, latchB, isSilentB()) : counterB);
             
         case 0x08: // CIA_EVENT_0_7
             return tod.getCounterLo();
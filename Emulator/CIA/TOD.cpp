@@ -44,6 +44,8 @@ TOD::_inspect() const
         info.value = tod.value;
         info.latch = latch.value;
         info.alarm = alarm.value;
+
+        publishedInfo.write(info);
     }
 }
 
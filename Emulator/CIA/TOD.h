@@ -33,6 +33,7 @@ class TOD : public SubComponent {
 
     // Result of the latest inspection
     mutable TODInfo info = {};
+    mutable util::Seqlock<TODInfo> publishedInfo;
             
     // The 24 bit counter
     Counter24 tod;
@@ -128,7 +129,7 @@ private:
     
 public:
     
-    TODInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    TODInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
     void _inspect() const override;
 
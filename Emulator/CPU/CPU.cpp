@@ -320,6 +320,8 @@ CPU::_inspect(u32 dasmStart) const
         info.usp = getUSP();
         info.ssp = getSSP();
         info.sr = getSR();
+
+        publishedInfo.write(info);
     }
 }
 
@@ -21,6 +21,7 @@ class CPU : public moira::Moira {
 
     // Result of the latest inspection
     mutable CPUInfo info = {};
+    mutable util::Seqlock<CPUInfo> publishedInfo;
 
     // Recorded call stack
     CallstackRecorder callstack;
@@ -128,7 +129,7 @@ public:
     
 public:
     
-    CPUInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    CPUInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
         
 
     //
@@ -27,6 +27,7 @@ class Denise : public SubComponent {
 
     // Result of the latest inspection
     mutable DeniseInfo info = {};
+    mutable util::Seqlock<DeniseInfo> publishedInfo;
     
     
     //
@@ -407,7 +408,7 @@ public:
 
 public:
     
-    DeniseInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    DeniseInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
     
     //
@@ -41,6 +41,8 @@ Denise::_inspect() const
             info.colorReg[i] = pixelEngine.getColor(i);
             info.color[i] = pixelEngine.getRGBA(i);
         }
+
+        publishedInfo.write(info);
     }
 }
 
@@ -21,6 +21,11 @@ Recorder::Recorder(Amiga& ref) : SubComponent(ref)
     FFmpeg::init();
 }
 
+Recorder::~Recorder()
+{
+    stopWriterThread();
+}
+
 void
 Recorder::_reset(bool hard)
 {
@@ -34,16 +39,104 @@ Recorder::_dump(Category category, std::ostream& os) const
 {
     using namespace util;
     
+    if (category == Category::Config) {
+
+        os << tab("Queue depth");
+        os << dec(config.queueDepth) << " frames" << std::endl;
+        os << tab("Drop frames");
+        os << bol(config.dropFrames) << std::endl;
+    }
+
     if (category == Category::State) {
         
+        auto stats = const_cast<Recorder *>(this)->getStats();
+
         os << tab("FFmpeg path");
         os << FFmpeg::getExecPath() << std::endl;
         os << tab("Installed");
         os << bol(FFmpeg::available()) << std::endl;
         os << tab("Recording");
         os << bol(isRecording()) << std::endl;
+        os << tab("Queued frames");
+        os << dec(stats.queued) << std::endl;
+        os << tab("Dropped frames");
+        os << dec(stats.dropped) << std::endl;
+        os << tab("Stalls");
+        os << dec(stats.stalls) << std::endl;
+        os << tab("Queue fill");
+        os << dec(stats.fill) << " (max " << dec(stats.maxFill) << ")" << std::endl;
+    }
+}
+
+RecorderConfig
+Recorder::getDefaultConfig()
+{
+    RecorderConfig defaults;
+
+    defaults.queueDepth = 8;
+    defaults.dropFrames = false;
+
+    return defaults;
+}
+
+void
+Recorder::resetConfig()
+{
+    auto defaults = getDefaultConfig();
+
+    setConfigItem(OPT_REC_QUEUE_DEPTH, defaults.queueDepth);
+    setConfigItem(OPT_REC_DROP_FRAMES, defaults.dropFrames);
+}
+
+i64
+Recorder::getConfigItem(Option option) const
+{
+    switch (option) {
+
+        case OPT_REC_QUEUE_DEPTH:   return (i64)config.queueDepth;
+        case OPT_REC_DROP_FRAMES:   return (i64)config.dropFrames;
+
+        default:
+            fatalError;
     }
 }
+
+void
+Recorder::setConfigItem(Option option, i64 value)
+{
+    switch (option) {
+
+        case OPT_REC_QUEUE_DEPTH:
+
+            if (value < 1 || value > 256) {
+                throw VAError(ERROR_OPT_INVARG, "1...256");
+            }
+
+            {   std::lock_guard<std::mutex> lock(queueMutex);
+                config.queueDepth = (isize)value;
+            }
+            queueCond.notify_all();
+            return;
+
+        case OPT_REC_DROP_FRAMES:
+
+            {   std::lock_guard<std::mutex> lock(queueMutex);
+                config.dropFrames = (bool)value;
+            }
+            queueCond.notify_all();
+            return;
+
+        default:
+            fatalError;
+    }
+}
+
+RecorderStats
+Recorder::getStats()
+{
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return stats;
+}
     
 string
 Recorder::videoPipePath()
@@ -124,8 +217,11 @@ Recorder::startRecording(int x1, int y1, int x2, int y2,
     // Create temporary buffers
     debug(REC_DEBUG, "Creating buffers...\n");
     
-    videoData.alloc((x2 - x1) * (y2 - y1));
-    audioData.alloc(2 * samplesPerFrame);
+    queue.clear();
+    pool.clear();
+    stats = { };
+    packet.video.assign(sizeof(u32) * (x2 - x1) * (y2 - y1), 0);
+    packet.audio.assign(2 * sizeof(float) * samplesPerFrame, 0);
     
     //
     // Assemble the command line arguments for the video encoder
@@ -227,6 +323,11 @@ Recorder::startRecording(int x1, int y1, int x2, int y2,
         throw VAError(ERROR_REC_LAUNCH, "Unable to launch the audio pipe.");
     }
     
+    // Launch the writer thread
+    stopWriter = false;
+    writeError = false;
+    writer = std::thread(&Recorder::writerLoop, this);
+
     debug(REC_DEBUG, "Success\n");
     state = State::prepare;    
 }
@@ -318,8 +419,16 @@ Recorder::record(Cycle target)
     assert(videoPipe.isOpen());
     assert(audioPipe.isOpen());
     
+    // Check if the writer thread has failed to feed the encoders
+    if (writeError) {
+
+        state = State::abort;
+        return;
+    }
+
     recordVideo(target);
     recordAudio(target);
+    enqueue();
 }
 
 void
@@ -331,20 +440,13 @@ Recorder::recordVideo(Cycle target)
     isize height = cutout.y2 - cutout.y1;
     isize offset = cutout.y1 * HPIXELS + cutout.x1 + HBLANK_MIN * 4;
     u8 *src = (u8 *)(buffer + offset);
-    u8 *dst = (u8 *)videoData.ptr;
+    u8 *dst = packet.video.data();
     
+    assert(isize(packet.video.size()) == width * height);
+
     for (isize y = 0; y < height; y++, src += 4 * HPIXELS, dst += width) {
         std::memcpy(dst, src, width);
     }
-    
-    // Feed the video pipe
-    assert(videoPipe.isOpen());
-    isize length = width * height;
-    isize written = videoPipe.write((u8 *)videoData.ptr, length);
-    
-    if (written != length || FORCE_RECORDING_ERROR) {
-        state = State::abort;
-    }
 }
 
 void
@@ -367,21 +469,16 @@ Recorder::recordAudio(Cycle target)
     audioClock = target;
     
     // Copy samples to buffer
-    muxer.copy(audioData.ptr, samplesPerFrame);
-    
-    // Feed the audio pipe
-    assert(audioPipe.isOpen());
-    isize length = 2 * sizeof(float) * samplesPerFrame;
-    isize written = audioPipe.write((u8 *)audioData.ptr, length);
- 
-    if (written != length || FORCE_RECORDING_ERROR) {
-        state = State::abort;
-    }
+    assert(isize(packet.audio.size()) == isize(2 * sizeof(float) * samplesPerFrame));
+    muxer.copy((float *)packet.audio.data(), samplesPerFrame);
 }
 
 void
 Recorder::finalize()
 {    
+    // Write all pending frames
+    stopWriterThread();
+
     // Close pipes
     videoPipe.close();
     audioPipe.close();
@@ -402,3 +499,97 @@ Recorder::abort()
     finalize();
     msgQueue.put(MSG_RECORDING_ABORTED);
 }
+
+void
+Recorder::enqueue()
+{
+    Packet next;
+
+    {   std::unique_lock<std::mutex> lock(queueMutex);
+
+        if (isize(queue.size()) >= config.queueDepth) {
+
+            // Discard the frame if the user prefers smooth emulation
+            if (config.dropFrames) {
+
+                stats.dropped++;
+                return;
+            }
+
+            // Otherwise, wait for the writer thread to catch up
+            stats.stalls++;
+            queueCond.wait(lock, [this]() {
+                return isize(queue.size()) < config.queueDepth || config.dropFrames;
+            });
+        }
+
+        queue.push_back(std::move(packet));
+        stats.queued++;
+        stats.fill = isize(queue.size());
+        stats.maxFill = std::max(stats.maxFill, stats.fill);
+
+        // Recycle a packet that has already been written
+        if (!pool.empty()) {
+
+            next = std::move(pool.back());
+            pool.pop_back();
+        }
+    }
+    queueCond.notify_all();
+
+    // Make sure the packet for the next frame has the proper size
+    packet = std::move(next);
+    packet.video.resize(sizeof(u32) * (cutout.x2 - cutout.x1) * (cutout.y2 - cutout.y1));
+    packet.audio.resize(2 * sizeof(float) * samplesPerFrame);
+}
+
+void
+Recorder::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+
+    while (true) {
+
+        queueCond.wait(lock, [this]() { return !queue.empty() || stopWriter; });
+
+        // Terminate if all frames have been written
+        if (queue.empty()) break;
+
+        auto next = std::move(queue.front());
+        queue.pop_front();
+        stats.fill = isize(queue.size());
+
+        lock.unlock();
+        queueCond.notify_all();
+
+        // Feed the pipes (after a failure, all remaining frames are discarded)
+        if (!writeError) {
+
+            auto videoLength = isize(next.video.size());
+            auto audioLength = isize(next.audio.size());
+
+            if (videoPipe.write(next.video.data(), videoLength) != videoLength ||
+                audioPipe.write(next.audio.data(), audioLength) != audioLength ||
+                FORCE_RECORDING_ERROR) {
+
+                writeError = true;
+            }
+        }
+
+        lock.lock();
+        pool.push_back(std::move(next));
+    }
+}
+
+void
+Recorder::stopWriterThread()
+{
+    if (!writer.joinable()) return;
+
+    {   std::lock_guard<std::mutex> lock(queueMutex);
+        stopWriter = true;
+    }
+    queueCond.notify_all();
+
+    writer.join();
+}
@@ -10,15 +10,21 @@
 #pragma once
 
 #include "SubComponent.h"
+#include "RecorderTypes.h"
 #include "Chrono.h"
 #include "FFmpeg.h"
 #include "Muxer.h"
 #include "NamedPipe.h"
+#include <condition_variable>
+#include <deque>
 
 using util::Buffer;
 
 class Recorder : public SubComponent {
-        
+
+    // Current configuration
+    RecorderConfig config = {};
+
     //
     // Sub components
     //
@@ -73,10 +79,43 @@ class Recorder : public SubComponent {
     util::Time recStart;
     util::Time recStop;
     
-    // Temporary storage for audio and video data
-    Buffer<u32> videoData;
-    Buffer<float> audioData;
-    
+
+    //
+    // Writer thread
+    //
+
+    /* Captured frames are not written to the encoder pipes directly. Instead,
+     * they are handed over to a separate thread which feeds the pipes. Hence,
+     * a stalling FFmpeg instance only stalls the emulator if the queue runs
+     * full and the recorder is configured to wait in this case.
+     */
+    struct Packet {
+
+        std::vector<u8> video;
+        std::vector<u8> audio;
+    };
+
+    // The frame that is currently assembled
+    Packet packet;
+
+    // Frames waiting to be written and recycled packets
+    std::deque<Packet> queue;
+    std::vector<Packet> pool;
+
+    // Protects the queue, the pool, and the statistics
+    std::mutex queueMutex;
+    std::condition_variable queueCond;
+
+    // The writer thread and its termination flag
+    std::thread writer;
+    bool stopWriter = false;
+
+    // Set by the writer thread if a pipe can't be fed any more
+    std::atomic<bool> writeError = false;
+
+    // Queue statistics
+    RecorderStats stats = {};
+
     
     //
     // Initializing
@@ -85,6 +124,7 @@ class Recorder : public SubComponent {
 public:
     
     Recorder(Amiga& ref);
+    ~Recorder();
     
     
     //
@@ -123,10 +163,36 @@ private:
     isize _save(u8 *buffer) override { SAVE_SNAPSHOT_ITEMS }
 
     
+    //
+    // Configuring
+    //
+
+public:
+
+    static RecorderConfig getDefaultConfig();
+    const RecorderConfig &getConfig() const { return config; }
+    void resetConfig() override;
+
+    i64 getConfigItem(Option option) const;
+    void setConfigItem(Option option, i64 value);
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    // Returns the queue statistics of the current or most recent recording
+    RecorderStats getStats();
+
+
     //
     // Querying locations and flags
     //
-    
+
+private:
+
     // Returns the paths to the two named input pipes
     string videoPipePath();
     string audioPipePath();
@@ -188,4 +254,13 @@ private:
     void recordAudio(Cycle target);
     void finalize();
     void abort();
+
+    // Hands the current frame over to the writer thread
+    void enqueue();
+
+    // Main entry point of the writer thread
+    void writerLoop();
+
+    // Terminates the writer thread after all queued frames have been written
+    void stopWriterThread();
 };
@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+#include "Reflection.h"
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Maximum number of frames waiting to be written to the encoders
+    isize queueDepth;
+
+    // Indicates whether frames are dropped or the emulator waits if the queue is full
+    bool dropFrames;
+}
+RecorderConfig;
+
+typedef struct
+{
+    // Number of frames handed over to the writer thread
+    isize queued;
+
+    // Number of frames discarded because the queue was full
+    isize dropped;
+
+    // Number of times the emulator had to wait for a free queue slot
+    isize stalls;
+
+    // Current and maximum number of frames in the queue
+    isize fill;
+    isize maxFill;
+}
+RecorderStats;
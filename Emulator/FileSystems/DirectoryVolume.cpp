@@ -0,0 +1,821 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "DirectoryVolume.h"
+#include "Checksum.h"
+#include "FSBlock.h"
+#include "FSObjects.h"
+#include "MemUtils.h"
+#include "Serialization.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+
+static time_t
+hostTime(const fs::path &path)
+{
+    std::error_code ec;
+    auto ftime = fs::last_write_time(path, ec);
+    if (ec) return time(nullptr);
+
+    // Translate the file time into a system time
+    auto stime = std::chrono::time_point_cast<std::chrono::system_clock::duration>
+    (ftime - fs::file_time_type::clock::now() + std::chrono::system_clock::now());
+
+    return std::chrono::system_clock::to_time_t(stime);
+}
+
+DirectoryVolume::DirectoryVolume(const fs::path &path, isize numBlocks, const string &name)
+{
+    init(path, numBlocks, name);
+}
+
+DirectoryVolume::DirectoryVolume(const Buffer<u8> &state)
+{
+    const u8 *ptr = state.ptr;
+    const u8 *end = state.ptr + state.size;
+
+    auto need = [&](isize count) {
+        if (end - ptr < count) throw VAError(ERROR_SNAP_CORRUPTED);
+    };
+    auto read32 = [&]() { need(4); return util::read32(ptr); };
+    auto readPath = [&]() {
+        auto len = isize(read32()); need(len);
+        string result((const char *)ptr, len); ptr += len;
+        return result;
+    };
+
+    auto path = readPath();
+    auto numBlocks = isize(read32());
+    auto volName = readPath();
+
+    init(path, numBlocks, volName);
+
+    // Scan the host directories in the same order as before
+    for (isize i = 0, count = read32(); i < count; i++) {
+
+        auto rel = readPath();
+        auto dir = rel.empty() ? root : root / fs::path(rel);
+        auto it = std::find_if(nodes.begin(), nodes.end(), [&](const Node &node) {
+            return node.isDir && node.path == dir;
+        });
+
+        if (it == nodes.end()) {
+            warn("%s: Directory has vanished\n", dir.string().c_str());
+            continue;
+        }
+        list(isize(it - nodes.begin()));
+    }
+
+    // Restore all blocks written by the Amiga
+    for (isize i = 0, count = read32(); i < count; i++) {
+
+        auto nr = Block(read32());
+        need(1 + bsize);
+        bool dirty = util::read8(ptr);
+        if (isize(nr) >= capacity) throw VAError(ERROR_SNAP_CORRUPTED);
+
+        overlay[nr].assign(ptr, ptr + bsize);
+        ptr += bsize;
+
+        if (dirty) {
+
+            pending.insert(nr);
+            if (auto n = owner(nr); n >= 0) nodes[n].modified = true;
+        }
+    }
+}
+
+void
+DirectoryVolume::init(const fs::path &path, isize numBlocks, const string &name)
+{
+    if (!util::isDirectory(path.string())) throw VAError(ERROR_DIR_NOT_FOUND);
+
+    root = path;
+    capacity = numBlocks;
+    this->name = name;
+
+    // Place the root block in the middle of the volume
+    rootBlock = Block(capacity / 2);
+
+    // Place the bitmap blocks and bitmap extension blocks behind the root block
+    isize bitsPerBlock = (bsize - 4) * 8;
+    isize refsPerBlock = (bsize / 4) - 1;
+    isize numBmBlocks = (capacity - 2 + bitsPerBlock - 1) / bitsPerBlock;
+    isize numExtBlocks = numBmBlocks > 25 ? (numBmBlocks - 25 + refsPerBlock - 1) / refsPerBlock : 0;
+
+    for (isize i = 0; i < numBmBlocks; i++) {
+        bmBlocks.push_back(Block(rootBlock + 1 + i));
+    }
+    for (isize i = 0; i < numExtBlocks; i++) {
+        bmExtBlocks.push_back(Block(rootBlock + 1 + numBmBlocks + i));
+    }
+
+    // Reserve a quarter of the volume for files created by the Amiga
+    freeEnd = Block(2 + (capacity - 2) / 4);
+    hostStart = Block(rootBlock + 1 + numBmBlocks + numExtBlocks);
+    next = hostStart;
+
+    if (hostStart >= capacity || freeEnd >= rootBlock) {
+        throw VAError(ERROR_FS_WRONG_CAPACITY);
+    }
+
+    // Create the root node
+    Node node;
+    node.path = path;
+    node.name = FSName(name).cpp_str();
+    node.header = rootBlock;
+    node.mtime = hostTime(path);
+    node.isDir = true;
+    nodes.push_back(node);
+
+    debug(FS_DEBUG, "Mirroring %s (%ld blocks)\n", path.string().c_str(), capacity);
+}
+
+void
+DirectoryVolume::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::Volumes) {
+
+        os << tab("Host directory");
+        os << root.string() << std::endl;
+        os << tab("Capacity");
+        os << dec(capacity) << " blocks" << std::endl;
+        os << tab("Free region");
+        os << dec(freeEnd - 2) << " blocks" << std::endl;
+        os << tab("Discovered items");
+        os << dec(numItems()) << std::endl;
+        os << tab("Written blocks");
+        os << dec(numWrittenBlocks()) << std::endl;
+        os << tab("Cached blocks");
+        os << dec(isize(cache.size())) << std::endl;
+        os << tab("Unflushed changes");
+        os << bol(isDirty()) << std::endl;
+    }
+}
+
+u64
+DirectoryVolume::fnv() const
+{
+    auto path = root.string();
+    u64 result = util::fnv64((const u8 *)path.c_str(), isize(path.size()));
+
+    // Combine the checksums of all written blocks (order independent)
+    for (auto &it : overlay) {
+        result += util::fnv64(it.second.data(), bsize) * (u64(it.first) + 1);
+    }
+
+    return result;
+}
+
+void
+DirectoryVolume::readBlock(Block nr, u8 *dst)
+{
+    assert(isize(nr) < capacity);
+    std::memcpy(dst, fetch(nr), bsize);
+}
+
+void
+DirectoryVolume::writeBlock(Block nr, const u8 *src)
+{
+    assert(isize(nr) < capacity);
+
+    // Store the block in the overlay
+    overlay[nr].assign(src, src + bsize);
+    pending.insert(nr);
+    revision++;
+
+    // Drop the generated version
+    if (auto it = cache.find(nr); it != cache.end()) {
+
+        lru.erase(it->second.second);
+        cache.erase(it);
+    }
+
+    // Remember that the owning item has been touched
+    if (auto n = owner(nr); n >= 0) nodes[n].modified = true;
+}
+
+void
+DirectoryVolume::exportBlocks(u8 *dst)
+{
+    // Assign block numbers to all items (the node list grows while listing)
+    for (isize i = 0; i < isize(nodes.size()); i++) {
+        if (nodes[i].isDir) list(i);
+    }
+
+    // Compose the image without disturbing the block cache
+    for (isize nr = 0; nr < capacity; nr++, dst += bsize) {
+
+        if (auto it = overlay.find(Block(nr)); it != overlay.end()) {
+            std::memcpy(dst, it->second.data(), bsize);
+        } else {
+            generate(Block(nr), dst);
+        }
+    }
+}
+
+void
+DirectoryVolume::saveState(Buffer<u8> &state) const
+{
+    std::vector<u8> bytes;
+
+    auto write32 = [&](u32 value) {
+        for (isize i = 24; i >= 0; i -= 8) bytes.push_back(u8(value >> i));
+    };
+    auto writePath = [&](const string &str) {
+        write32(u32(str.size()));
+        bytes.insert(bytes.end(), str.begin(), str.end());
+    };
+
+    writePath(root.string());
+    write32(u32(capacity));
+    writePath(name);
+
+    // Record the scanning order, because it determines the block layout
+    write32(u32(scanned.size()));
+    for (auto node : scanned) {
+        writePath(node ? nodes[node].path.lexically_relative(root).string() : "");
+    }
+
+    // Record all blocks written by the Amiga
+    write32(u32(overlay.size()));
+    for (auto &it : overlay) {
+
+        write32(u32(it.first));
+        bytes.push_back(pending.count(it.first) ? 1 : 0);
+        bytes.insert(bytes.end(), it.second.begin(), it.second.end());
+    }
+
+    state.init(bytes.data(), isize(bytes.size()));
+}
+
+isize
+DirectoryVolume::owner(Block nr) const
+{
+    auto it = extents.upper_bound(nr);
+    if (it == extents.begin()) return -1;
+    --it;
+
+    auto &node = nodes[it->second];
+    isize size = node.isDir ? 1 : 1 + node.numListBlocks + node.numDataBlocks;
+
+    return isize(nr) < isize(node.header) + size ? it->second : -1;
+}
+
+const u8 *
+DirectoryVolume::fetch(Block nr)
+{
+    // Blocks written by the Amiga take precedence
+    if (auto it = overlay.find(nr); it != overlay.end()) {
+        return it->second.data();
+    }
+
+    // Check if the block has been generated recently
+    if (auto it = cache.find(nr); it != cache.end()) {
+
+        lru.splice(lru.begin(), lru, it->second.second);
+        return it->second.first.data();
+    }
+
+    // Evict the least recently used block if the cache is full
+    if (isize(cache.size()) >= cacheSize) {
+
+        cache.erase(lru.back());
+        lru.pop_back();
+    }
+
+    // Generate the block
+    lru.push_front(nr);
+    auto &entry = cache[nr];
+    entry.first.resize(bsize);
+    entry.second = lru.begin();
+    generate(nr, entry.first.data());
+
+    return entry.first.data();
+}
+
+u32
+DirectoryVolume::get32(const u8 *block, isize n) const
+{
+    return FSBlock::read32(block + 4 * n + (n < 0 ? bsize : 0));
+}
+
+void
+DirectoryVolume::set32(u8 *block, isize n, u32 value) const
+{
+    FSBlock::write32(addr32(block, n), value);
+}
+
+void
+DirectoryVolume::updateChecksum(u8 *block, isize pos) const
+{
+    u32 result = 0;
+
+    set32(block, pos, 0);
+    for (isize i = 0; i < bsize / 4; i++) U32_INC(result, get32(block, i));
+    set32(block, pos, ~result + 1);
+}
+
+void
+DirectoryVolume::generate(Block nr, u8 *dst)
+{
+    std::memset(dst, 0, bsize);
+
+    // Boot blocks
+    if (nr == 0) { generateBootBlock(dst); return; }
+    if (nr == 1) return;
+
+    // Root block
+    if (nr == rootBlock) { generateRootBlock(dst); return; }
+
+    // Bitmap blocks and bitmap extension blocks
+    if (nr > rootBlock && nr < hostStart) {
+
+        if (isize(nr - rootBlock) <= isize(bmBlocks.size())) {
+            generateBitmapBlock(nr, dst);
+        } else {
+            generateBitmapExtBlock(nr, dst);
+        }
+        return;
+    }
+
+    // Blocks belonging to a host item
+    if (auto n = owner(nr); n >= 0) {
+
+        auto &node = nodes[n];
+        auto offset = isize(nr - node.header);
+
+        if (offset == 0) {
+            node.isDir ? generateDirBlock(n, dst) : generateHeaderBlock(n, dst);
+        } else if (offset <= node.numListBlocks) {
+            generateListBlock(n, offset - 1, dst);
+        } else {
+            generateDataBlock(n, offset - 1 - node.numListBlocks, dst);
+        }
+    }
+}
+
+void
+DirectoryVolume::generateBootBlock(u8 *dst) const
+{
+    u32 result = 0, prec;
+
+    std::memcpy(dst, "DOS\1", 4);
+
+    // Compute the checksum (the second boot block is empty)
+    for (isize i = 0; i < bsize / 4; i++) {
+
+        if (i == 1) continue;
+        prec = result;
+        if ((result += get32(dst, i)) < prec) result++;
+    }
+    set32(dst, 1, ~result);
+}
+
+void
+DirectoryVolume::generateBitmapBlock(Block nr, u8 *dst) const
+{
+    isize bitsPerBlock = (bsize - 4) * 8;
+    isize first = 2 + (nr - rootBlock - 1) * bitsPerBlock;
+
+    // Only the blocks in the free region are reported as free
+    for (isize i = 1; i < bsize / 4; i++) {
+
+        u32 value = 0;
+
+        for (isize j = 0; j < 32; j++) {
+
+            auto block = first + (i - 1) * 32 + j;
+            if (block < isize(freeEnd)) value |= 1U << j;
+        }
+        set32(dst, i, value);
+    }
+
+    updateChecksum(dst, 0);
+}
+
+void
+DirectoryVolume::generateBitmapExtBlock(Block nr, u8 *dst) const
+{
+    isize refsPerBlock = (bsize / 4) - 1;
+    isize index = nr - bmExtBlocks[0];
+    isize first = 25 + index * refsPerBlock;
+
+    for (isize i = 0; i < refsPerBlock && first + i < isize(bmBlocks.size()); i++) {
+        set32(dst, i, bmBlocks[first + i]);
+    }
+
+    // Link to the next extension block
+    if (index + 1 < isize(bmExtBlocks.size())) set32(dst, -1, nr + 1);
+}
+
+void
+DirectoryVolume::generateRootBlock(u8 *dst)
+{
+    set32(dst, 0, 2);                               // Type
+    set32(dst, 3, 72);                              // Hash table size
+    writeHashTable(0, dst);                         // Hash table
+    set32(dst, -50, 0xFFFFFFFF);                    // Bitmap validity
+
+    // Bitmap block references
+    for (isize i = 0; i < 25 && i < isize(bmBlocks.size()); i++) {
+        set32(dst, i - 49, bmBlocks[i]);
+    }
+    if (!bmExtBlocks.empty()) set32(dst, -24, bmExtBlocks[0]);
+
+    FSTime(nodes[0].mtime).write(addr32(dst, -23)); // Modification date
+    FSName(nodes[0].name).write(addr32(dst, -20));  // Volume name
+    FSTime(nodes[0].mtime).write(addr32(dst, -10)); // Disk modification date
+    FSTime(nodes[0].mtime).write(addr32(dst, -7));  // Creation date
+    set32(dst, -1, 1);                              // Sub type
+
+    updateChecksum(dst, 5);
+}
+
+void
+DirectoryVolume::generateDirBlock(isize node, u8 *dst)
+{
+    auto header = nodes[node].header;
+    auto parent = nodes[nodes[node].parent].header;
+
+    set32(dst, 0, 2);                                   // Type
+    set32(dst, 1, header);                              // Block pointer to itself
+    writeHashTable(node, dst);                          // Hash table
+    FSTime(nodes[node].mtime).write(addr32(dst, -23));  // Modification date
+    FSName(nodes[node].name).write(addr32(dst, -20));   // Directory name
+    set32(dst, -4, nodes[node].nextHash);               // Next item with same hash
+    set32(dst, -3, parent);                             // Parent directory
+    set32(dst, -1, 2);                                  // Sub type
+
+    updateChecksum(dst, 5);
+}
+
+void
+DirectoryVolume::generateHeaderBlock(isize node, u8 *dst)
+{
+    auto &item = nodes[node];
+    isize count = std::min(item.numDataBlocks, bsize / 4 - 56);
+    Block firstData = Block(item.header + 1 + item.numListBlocks);
+    Block firstList = item.numListBlocks ? Block(item.header + 1) : 0;
+
+    set32(dst, 0, 2);                                   // Type
+    set32(dst, 1, item.header);                         // Block pointer to itself
+    set32(dst, 2, u32(count));                          // Number of data block refs
+    set32(dst, 4, count ? firstData : 0);               // First data block
+    writeDataBlockRefs(node, 0, count, dst);            // Data block refs
+    set32(dst, -47, item.size);                         // File size
+    FSTime(item.mtime).write(addr32(dst, -23));         // Modification date
+    FSName(item.name).write(addr32(dst, -20));          // File name
+    set32(dst, -4, item.nextHash);                      // Next item with same hash
+    set32(dst, -3, nodes[item.parent].header);          // Parent directory
+    set32(dst, -2, firstList);                          // First file list block
+    set32(dst, -1, (u32)-3);                            // Sub type
+
+    updateChecksum(dst, 5);
+}
+
+void
+DirectoryVolume::generateListBlock(isize node, isize nr, u8 *dst)
+{
+    auto &item = nodes[node];
+    isize maxRefs = bsize / 4 - 56;
+    isize first = (nr + 1) * maxRefs;
+    isize count = std::min(item.numDataBlocks - first, maxRefs);
+    Block self = Block(item.header + 1 + nr);
+    Block nextList = nr + 1 < item.numListBlocks ? Block(self + 1) : 0;
+
+    set32(dst, 0, 16);                                  // Type
+    set32(dst, 1, self);                                // Block pointer to itself
+    set32(dst, 2, u32(count));                          // Number of data block refs
+    set32(dst, 4, Block(item.header + 1 + item.numListBlocks + first));
+    writeDataBlockRefs(node, first, count, dst);        // Data block refs
+    set32(dst, -3, item.header);                        // File header block
+    set32(dst, -2, nextList);                           // Next file list block
+    set32(dst, -1, (u32)-3);                            // Sub type
+
+    updateChecksum(dst, 5);
+}
+
+void
+DirectoryVolume::generateDataBlock(isize node, isize nr, u8 *dst)
+{
+    auto &item = nodes[node];
+    isize offset = nr * bsize;
+    isize count = std::min(bsize, isize(item.size) - offset);
+
+    if (count <= 0) return;
+
+    // Open the host file if it isn't open yet
+    if (streamNode != node) {
+
+        stream.close();
+        stream.clear();
+        stream.open(item.path, std::ios::binary);
+        streamNode = node;
+    }
+
+    // Read the data (missing bytes remain zero)
+    stream.seekg(offset);
+    stream.read((char *)dst, count);
+    if (!stream) stream.clear();
+}
+
+void
+DirectoryVolume::writeHashTable(isize node, u8 *dst)
+{
+    list(node);
+
+    // Record the first item of each hash chain
+    for (auto child : nodes[node].children) {
+
+        auto slot = FSName(nodes[child].name).hashValue() % 72;
+        if (get32(dst, 6 + slot) == 0) set32(dst, 6 + slot, nodes[child].header);
+    }
+}
+
+void
+DirectoryVolume::writeDataBlockRefs(isize node, isize first, isize count, u8 *dst) const
+{
+    auto &item = nodes[node];
+    Block firstData = Block(item.header + 1 + item.numListBlocks);
+
+    // Data block references are stored in reverse order
+    for (isize i = 0; i < count; i++) {
+        set32(dst, -51 - i, Block(firstData + first + i));
+    }
+}
+
+void
+DirectoryVolume::list(isize node)
+{
+    if (nodes[node].listed) return;
+    nodes[node].listed = true;
+    scanned.push_back(node);
+    revision++;
+
+    isize maxRefs = bsize / 4 - 56;
+    std::vector<isize> children;
+    std::set<string> names;
+    std::error_code ec;
+
+    auto options = fs::directory_options::skip_permission_denied;
+    for (const auto &entry : fs::directory_iterator(nodes[node].path, options, ec)) {
+
+        const auto hostName = entry.path().filename().string();
+
+        // Skip all hidden files
+        if (hostName[0] == '.') continue;
+
+        bool isDir = entry.is_directory(ec);
+        bool isFile = entry.is_regular_file(ec);
+        if (!isDir && !isFile) continue;
+
+        Node item;
+        item.path = entry.path();
+        item.name = FSName(hostName).cpp_str();
+        item.parent = node;
+        item.mtime = hostTime(entry.path());
+        item.isDir = isDir;
+
+        // Skip items whose Amiga name clashes with a previous item
+        string key = item.name;
+        for (auto &c : key) c = FSString::capital(c);
+        if (!names.insert(key).second) {
+
+            debug(FS_DEBUG, "Skipping %s (duplicate name)\n", hostName.c_str());
+            continue;
+        }
+
+        if (isFile) {
+
+            auto size = entry.file_size(ec);
+            if (ec || size > UINT32_MAX) continue;
+
+            item.size = u32(size);
+            item.numDataBlocks = (isize(size) + bsize - 1) / bsize;
+            if (item.numDataBlocks > maxRefs) {
+                item.numListBlocks = (item.numDataBlocks - 1) / maxRefs;
+            }
+        }
+
+        // Assign an extent
+        item.header = allocate(1 + item.numListBlocks + item.numDataBlocks);
+        if (!item.header) {
+
+            warn("%s: Volume is full\n", nodes[node].path.string().c_str());
+            break;
+        }
+
+        extents[item.header] = isize(nodes.size());
+        children.push_back(isize(nodes.size()));
+        nodes.push_back(std::move(item));
+    }
+
+    // Chain all items with the same hash value
+    std::unordered_map<u32, isize> last;
+    for (auto child : children) {
+
+        auto slot = FSName(nodes[child].name).hashValue() % 72;
+        if (auto it = last.find(slot); it != last.end()) {
+            nodes[it->second].nextHash = nodes[child].header;
+        }
+        last[slot] = child;
+    }
+
+    nodes[node].children = std::move(children);
+
+    debug(FS_DEBUG, "Listed %s (%zu items, next free block: %d)\n",
+          nodes[node].path.string().c_str(), nodes[node].children.size(), next);
+}
+
+Block
+DirectoryVolume::allocate(isize count)
+{
+    // Try the upper part of the host region first
+    if (next >= hostStart) {
+
+        if (next + count <= capacity) {
+
+            auto result = next;
+            next = Block(next + count);
+            return result;
+        }
+        next = freeEnd;
+    }
+
+    // Try the lower part of the host region
+    if (next + count <= rootBlock) {
+
+        auto result = next;
+        next = Block(next + count);
+        return result;
+    }
+
+    return 0;
+}
+
+void
+DirectoryVolume::flush()
+{
+    if (pending.empty()) return;
+
+    debug(FS_DEBUG, "Flushing %zu modified blocks\n", pending.size());
+
+    flushDir(rootBlock, root, 0);
+
+    pending.clear();
+    for (auto &node : nodes) node.modified = false;
+    revision++;
+}
+
+void
+DirectoryVolume::flushDir(Block nr, const fs::path &path, isize depth)
+{
+    // Guard against cyclic directory structures
+    if (depth > 64) return;
+
+    auto ptr = fetch(nr);
+    std::vector<u8> dir(ptr, ptr + bsize);
+    std::vector<u8> item(bsize);
+
+    for (isize slot = 0; slot < 72; slot++) {
+
+        std::set<Block> visited;
+
+        for (Block ref = get32(dir.data(), 6 + slot); ref; ref = get32(item.data(), -4)) {
+
+            // Break the loop if we visit a block twice or the reference is bad
+            if (isize(ref) >= capacity || !visited.insert(ref).second) break;
+
+            std::memcpy(item.data(), fetch(ref), bsize);
+            auto type = get32(item.data(), 0);
+            auto subtype = get32(item.data(), -1);
+
+            // Check if the item originates from the host
+            auto node = owner(ref);
+            if (node >= 0 && nodes[node].header != ref) node = -1;
+
+            auto target = node >= 0 ?
+            nodes[node].path : path / FSName(addr32(item.data(), -20)).cpp_str();
+
+            if (type == 2 && subtype == 2) {
+
+                // Only descend into directories the Amiga has looked at
+                if (node >= 0 && !nodes[node].listed) continue;
+
+                std::error_code ec;
+                fs::create_directories(target, ec);
+                if (ec) throw VAError(ERROR_FS_CANNOT_CREATE_DIR, target.string());
+
+                flushDir(ref, target, depth + 1);
+            }
+            if (type == 2 && subtype == (u32)-3) {
+
+                if (node >= 0 ? nodes[node].modified : isModified(ref)) {
+                    flushFile(ref, target, node);
+                }
+            }
+        }
+    }
+}
+
+void
+DirectoryVolume::flushFile(Block nr, const fs::path &path, isize node)
+{
+    std::vector<Block> lists, data;
+
+    if (!collectBlocks(nr, lists, data)) {
+
+        warn("%s: Corrupted file structure\n", path.string().c_str());
+        return;
+    }
+
+    // Assemble the file contents
+    isize size = get32(fetch(nr), -47);
+    std::vector<u8> buffer(size);
+
+    for (isize i = 0, offset = 0; offset < size && i < isize(data.size()); i++) {
+
+        auto count = std::min(bsize, size - offset);
+        if (isize(data[i]) < capacity) {
+            std::memcpy(buffer.data() + offset, fetch(data[i]), count);
+        }
+        offset += count;
+    }
+
+    /* If the file originates from the host, freeze the current contents of
+     * all generated blocks. Otherwise, they would change under the hood once
+     * the host file has been rewritten.
+     */
+    if (node >= 0) {
+
+        auto header = nodes[node].header;
+        auto count = nodes[node].numListBlocks + nodes[node].numDataBlocks;
+
+        for (isize i = 0; i <= count; i++) {
+
+            auto ref = Block(header + i);
+            if (!overlay.contains(ref)) {
+                auto ptr = fetch(ref);
+                overlay[ref].assign(ptr, ptr + bsize);
+            }
+        }
+    }
+
+    // Close the host file if it is currently opened for reading
+    if (node == streamNode) { stream.close(); streamNode = -1; }
+
+    // Write the file
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) throw VAError(ERROR_FILE_CANT_WRITE, path.string());
+    os.write((const char *)buffer.data(), size);
+
+    debug(FS_DEBUG, "Wrote %s (%ld bytes)\n", path.string().c_str(), size);
+}
+
+bool
+DirectoryVolume::collectBlocks(Block nr, std::vector<Block> &lists, std::vector<Block> &data)
+{
+    isize maxRefs = bsize / 4 - 56;
+    std::set<Block> visited;
+
+    for (Block ref = nr; ref; ) {
+
+        // Break the loop if we visit a block twice or the reference is bad
+        if (isize(ref) >= capacity || !visited.insert(ref).second) return false;
+        if (ref != nr) lists.push_back(ref);
+
+        auto block = fetch(ref);
+        isize count = std::min(isize(get32(block, 2)), maxRefs);
+
+        for (isize i = 0; i < count; i++) data.push_back(get32(block, -51 - i));
+        ref = get32(block, -2);
+    }
+
+    return true;
+}
+
+bool
+DirectoryVolume::isModified(Block nr)
+{
+    std::vector<Block> lists, data;
+
+    if (pending.contains(nr)) return true;
+    if (!collectBlocks(nr, lists, data)) return false;
+
+    for (auto ref : lists) if (pending.contains(ref)) return true;
+    for (auto ref : data) if (pending.contains(ref)) return true;
+
+    return false;
+}
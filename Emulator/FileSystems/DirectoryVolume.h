@@ -0,0 +1,274 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "AmigaObject.h"
+#include "Buffer.h"
+#include "FSTypes.h"
+#include "IOUtils.h"
+#include <fstream>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+using util::Buffer;
+
+/* A DirectoryVolume is a block device that mirrors a directory of the host
+ * file system as an FFS volume. In contrast to MutableFileSystem, which
+ * converts the whole directory tree into an in-memory block image up front,
+ * all blocks are generated on demand. Block numbers are handed out lazily,
+ * too. When a directory block is accessed for the first time, the host
+ * directory is scanned and each item is assigned a contiguous extent
+ * comprising its header block, its file list blocks, and its data blocks.
+ * Hence, mounting the volume takes constant time and the memory footprint
+ * only depends on the number of items the Amiga has actually looked at.
+ *
+ * The volume is divided into three regions. The metadata region contains the
+ * boot blocks, the root block, and the bitmap blocks. The host region is
+ * marked as allocated in the bitmap and contains all lazily generated items.
+ * The free region is reported as free space to the Amiga. Blocks written by
+ * the Amiga are stored in an overlay which takes precedence over the
+ * generated contents. Generated blocks are kept in a small LRU cache.
+ *
+ * Modified or newly created files are transferred back to the host by
+ * calling flush(). Nothing is written back implicitly. Deletions and renames
+ * are not propagated.
+ */
+class DirectoryVolume : public AmigaObject {
+
+    // Number of generated blocks kept in the LRU cache
+    static constexpr isize cacheSize = 1024;
+
+    // A file or directory of the host file system
+    struct Node {
+
+        // Location in the host file system
+        fs::path path;
+
+        // Amiga-side file name
+        string name;
+
+        // Parent directory (index into 'nodes')
+        isize parent = 0;
+
+        // Location of the header block (first block of the extent)
+        Block header = 0;
+
+        // Number of file list blocks and data blocks (files only)
+        isize numListBlocks = 0;
+        isize numDataBlocks = 0;
+
+        // File size in bytes (files only)
+        u32 size = 0;
+
+        // Modification date of the host item
+        time_t mtime = 0;
+
+        // Reference to the next item with the same hash value
+        Block nextHash = 0;
+
+        // Child items (directories only, valid if 'listed' is set)
+        std::vector<isize> children;
+
+        bool isDir = false;
+        bool listed = false;
+        bool modified = false;
+    };
+
+    // The mirrored host directory
+    fs::path root;
+
+    // Volume name
+    string name;
+
+    // Capacity and block size
+    isize capacity = 0;
+    isize bsize = 512;
+
+    // Location of the root block, bitmap blocks, and bitmap extension blocks
+    Block rootBlock = 0;
+    std::vector<Block> bmBlocks;
+    std::vector<Block> bmExtBlocks;
+
+    // Boundaries of the free region [2; freeEnd)
+    Block freeEnd = 0;
+
+    // Boundaries of the host region [hostStart; capacity) + [freeEnd; rootBlock)
+    Block hostStart = 0;
+
+    // Next unused block in the host region
+    Block next = 0;
+
+    // All items discovered so far (node 0 is the root directory)
+    std::vector<Node> nodes;
+
+    // All scanned directories in scanning order
+    std::vector<isize> scanned;
+
+    // Incremented whenever a directory is scanned or a block is written
+    isize revision = 0;
+
+    // Maps the first block of each extent to the owning node
+    std::map<Block, isize> extents;
+
+    // Blocks written by the Amiga
+    std::unordered_map<Block, std::vector<u8>> overlay;
+
+    // Blocks written since the last flush
+    std::set<Block> pending;
+
+    // Generated blocks (LRU cache)
+    std::list<Block> lru;
+    std::unordered_map<Block, std::pair<std::vector<u8>, std::list<Block>::iterator>> cache;
+
+    // The most recently opened host file
+    std::ifstream stream;
+    isize streamNode = -1;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    DirectoryVolume(const fs::path &path, isize numBlocks, const string &name) throws;
+
+    // Recreates a volume from a state saved by saveState()
+    DirectoryVolume(const Buffer<u8> &state) throws;
+
+private:
+
+    void init(const fs::path &path, isize numBlocks, const string &name) throws;
+
+
+    //
+    // Methods from AmigaObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "DirectoryVolume"; }
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Querying properties
+    //
+
+public:
+
+    // Returns the mirrored host directory
+    const fs::path &getPath() const { return root; }
+
+    // Returns capacity information
+    isize numBlocks() const { return capacity; }
+    isize numBytes() const { return capacity * bsize; }
+
+    // Returns the number of discovered items or written blocks
+    isize numItems() const { return isize(nodes.size()); }
+    isize numWrittenBlocks() const { return isize(overlay.size()); }
+
+    // Checks whether blocks have been written since the last flush
+    bool isDirty() const { return !pending.empty(); }
+
+    // Returns a counter that changes whenever the volume state changes
+    isize getRevision() const { return revision; }
+
+    // Computes a fingerprint for the current volume state
+    u64 fnv() const;
+
+
+    //
+    // Accessing blocks
+    //
+
+public:
+
+    // Reads a block
+    void readBlock(Block nr, u8 *dst);
+
+    // Writes a block
+    void writeBlock(Block nr, const u8 *src);
+
+    /* Writes the entire volume into a buffer of numBytes() bytes. All host
+     * directories are scanned beforehand. Hence, the image contains the
+     * complete directory tree, including the blocks written by the Amiga.
+     */
+    void exportBlocks(u8 *dst);
+
+    // Transfers all modified files back to the host file system
+    void flush() throws;
+
+    /* Saves the volume state. Generated blocks are not part of the state,
+     * because they can be recreated from the host directory. The state
+     * comprises the host path, the order in which directories have been
+     * scanned (which determines the block layout), and the written blocks.
+     */
+    void saveState(Buffer<u8> &state) const;
+
+private:
+
+    // Returns the node owning a certain block (-1 if the block is unassigned)
+    isize owner(Block nr) const;
+
+    // Looks up a block in the overlay, the cache, or generates it
+    const u8 *fetch(Block nr);
+
+    // Generates a block from the host file system
+    void generate(Block nr, u8 *dst);
+    void generateBootBlock(u8 *dst) const;
+    void generateBitmapBlock(Block nr, u8 *dst) const;
+    void generateBitmapExtBlock(Block nr, u8 *dst) const;
+    void generateRootBlock(u8 *dst);
+    void generateDirBlock(isize node, u8 *dst);
+    void generateHeaderBlock(isize node, u8 *dst);
+    void generateListBlock(isize node, isize nr, u8 *dst);
+    void generateDataBlock(isize node, isize nr, u8 *dst);
+
+    // Writes the hash table of a directory
+    void writeHashTable(isize node, u8 *dst);
+
+    // Writes the data block references of a header or a file list block
+    void writeDataBlockRefs(isize node, isize first, isize count, u8 *dst) const;
+
+    // Accesses the n-th long word of a block (negative values count from the end)
+    u8 *addr32(u8 *block, isize n) const { return block + 4 * n + (n < 0 ? bsize : 0); }
+    u32 get32(const u8 *block, isize n) const;
+    void set32(u8 *block, isize n, u32 value) const;
+
+    // Computes the checksum of a block and writes it to the specified location
+    void updateChecksum(u8 *block, isize pos) const;
+
+    // Scans a host directory and assigns block numbers to all items
+    void list(isize node);
+
+    // Reserves a contiguous range of blocks in the host region
+    Block allocate(isize count);
+
+
+    //
+    // Writing back
+    //
+
+    // Transfers the contents of a directory
+    void flushDir(Block nr, const fs::path &path, isize depth);
+
+    // Transfers a single file
+    void flushFile(Block nr, const fs::path &path, isize node);
+
+    // Collects all file list blocks and data blocks of a file
+    bool collectBlocks(Block nr, std::vector<Block> &lists, std::vector<Block> &data);
+
+    // Checks whether a file has been written to since the last flush
+    bool isModified(Block nr);
+};
@@ -12,26 +12,46 @@
 #include "MutableFileSystem.h"
 #include "MemUtils.h"
 
-FSBlock::FSBlock(FileSystem &ref, Block nr, FSBlockType t) : device(ref)
+void
+FSBlock::init(FSBlockType t)
 {
-    assert(t != FS_UNKNOWN_BLOCK);
-    
-    this->nr = nr;
-    this->type = t;
+    switch (t) {
+
+        case FS_EMPTY_BLOCK:
+        case FS_BOOT_BLOCK:
+        case FS_ROOT_BLOCK:
+        case FS_BITMAP_BLOCK:
+        case FS_BITMAP_EXT_BLOCK:
+        case FS_USERDIR_BLOCK:
+        case FS_FILEHEADER_BLOCK:
+        case FS_FILELIST_BLOCK:
+        case FS_DATA_BLOCK_OFS:
+        case FS_DATA_BLOCK_FFS:
+            break;
+            
+        default:
+            throw VAError(ERROR_FS_INVALID_BLOCK_TYPE);
+    }
+
+    device.types[nr] = u8(t);
+    device.corruptions[nr] = 0;
+
+    // Blocks referencing this block might have a different verdict now
+    device.invalidateVerdicts();
     
-    // Allocate memory if this block is not empty
-    if (type != FS_EMPTY_BLOCK) data.init(bsize(), 0);
+    // Wipe out the block data if this block is not empty
+    if (t != FS_EMPTY_BLOCK) std::memset(data, 0, bsize());
     
     // Initialize
-    switch (type) {
+    switch (t) {
 
         case FS_BOOT_BLOCK:
             
-            if (nr == 0 && ref.dos != FS_NODOS) {
+            if (nr == 0 && device.dos != FS_NODOS) {
                 data[0] = 'D';
                 data[1] = 'O';
                 data[2] = 'S';
-                data[3] = (u8)ref.dos;
+                data[3] = (u8)device.dos;
             }
             break;
             
@@ -80,32 +100,10 @@ FSBlock::FSBlock(FileSystem &ref, Block nr, FSBlockType t) : device(ref)
     }
 }
 
-FSBlock *
-FSBlock::make(FileSystem &ref, Block nr, FSBlockType type)
-{
-    switch (type) {
-
-        case FS_EMPTY_BLOCK:
-        case FS_BOOT_BLOCK:
-        case FS_ROOT_BLOCK:
-        case FS_BITMAP_BLOCK:
-        case FS_BITMAP_EXT_BLOCK:
-        case FS_USERDIR_BLOCK:
-        case FS_FILEHEADER_BLOCK:
-        case FS_FILELIST_BLOCK:
-        case FS_DATA_BLOCK_OFS:
-        case FS_DATA_BLOCK_FFS:
-            return new FSBlock(ref, nr, type);
-            
-        default:
-            throw VAError(ERROR_FS_INVALID_BLOCK_TYPE);
-    }
-}
-
 const char *
 FSBlock::getDescription() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_UNKNOWN_BLOCK:     return "FSBlock (Unknown)";
         case FS_EMPTY_BLOCK:       return "FSBlock (Empty)";
@@ -133,7 +131,7 @@ FSBlock::bsize() const
 isize
 FSBlock::dsize() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS: return bsize() - 24;
         case FS_DATA_BLOCK_FFS: return bsize();
@@ -149,7 +147,7 @@ FSBlock::itemType(isize byte) const
     // Translate the byte index to a (signed) long word index
     isize word = byte / 4; if (word >= 6) word -= bsize() / 4;
 
-    switch (type) {
+    switch (type()) {
             
         case FS_EMPTY_BLOCK:
             
@@ -318,13 +316,13 @@ FSBlock::itemType(isize byte) const
 u32
 FSBlock::typeID() const
 {
-    return type == FS_EMPTY_BLOCK ? 0 : get32(0);
+    return type() == FS_EMPTY_BLOCK ? 0 : get32(0);
 }
 
 u32
 FSBlock::subtypeID() const
 {
-    return type == FS_EMPTY_BLOCK ? 0 : get32((bsize() / 4) - 1);
+    return type() == FS_EMPTY_BLOCK ? 0 : get32((bsize() / 4) - 1);
 }
 
 isize
@@ -349,7 +347,7 @@ FSBlock::check(bool strict) const
 ErrorCode
 FSBlock::check(isize byte, u8 *expected, bool strict) const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_BOOT_BLOCK:
         {
@@ -542,7 +540,7 @@ FSBlock::check(isize byte, u8 *expected, bool strict) const
 u8 *
 FSBlock::addr32(isize nr) const
 {
-    return (data.ptr + 4 * nr) + (nr < 0 ? bsize() : 0);
+    return (data + 4 * nr) + (nr < 0 ? bsize() : 0);
 }
 
 u32
@@ -563,7 +561,7 @@ FSBlock::write32(u8 *p, u32 value)
 isize
 FSBlock::checksumLocation() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_BOOT_BLOCK:
 
@@ -590,7 +588,7 @@ FSBlock::checksumLocation() const
 u32
 FSBlock::checksum() const
 {
-    return type == FS_BOOT_BLOCK ? checksumBootBlock() : checksumStandard();
+    return type() == FS_BOOT_BLOCK ? checksumBootBlock() : checksumStandard();
 }
 
 u32
@@ -599,19 +597,12 @@ FSBlock::checksumStandard() const
     isize pos = checksumLocation();
     assert(pos >= 0 && pos <= 5);
     
-    // Wipe out the old checksum
-    u32 old = get32(pos);
-    set32(pos, 0);
-    
-    // Compute the new checksum
+    // Compute the new checksum (skipping the old one)
     u32 result = 0;
-    for (isize i = 0; i < bsize() / 4; i++) U32_INC(result, get32(i));
+    for (isize i = 0; i < bsize() / 4; i++) if (i != pos) U32_INC(result, get32(i));
     result = ~result;
     U32_INC(result, 1);
     
-    // Undo the modification
-    set32(pos, old);
-    
     return result;
 }
 
@@ -631,7 +622,7 @@ FSBlock::checksumBootBlock() const
     }
 
     // Second boot block
-    u8 *p = device.blocks[1]->data.ptr;
+    u8 *p = device.blocks[1]->data;
     
     for (isize i = 0; i < bsize() / 4; i++) {
         
@@ -652,7 +643,7 @@ FSBlock::updateChecksum()
 void
 FSBlock::dump() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_BOOT_BLOCK:
             
@@ -753,7 +744,7 @@ FSBlock::dump() const
 void
 FSBlock::dumpData() const
 {
-    if (!data.empty()) util::hexdumpLongwords(data.ptr, 512);
+    if (type() != FS_EMPTY_BLOCK) util::hexdumpLongwords(data, 512);
 }
 
 void
@@ -762,7 +753,8 @@ FSBlock::importBlock(const u8 *src, isize size)
     assert(src);
     assert(size == bsize());
 
-    if (!data.empty()) std::memcpy(data.ptr, src, size);
+    if (type() != FS_EMPTY_BLOCK) std::memcpy(data, src, size);
+    invalidate();
 }
 
 void
@@ -775,17 +767,17 @@ FSBlock::exportBlock(u8 *dst, isize size)
     updateChecksum();
 
     // Export the block
-    if (data.empty()) {
+    if (type() == FS_EMPTY_BLOCK) {
         std::memset(dst, 0, size);
     } else {
-        std::memcpy(dst, data.ptr, size);
+        std::memcpy(dst, data, size);
     }
 }
 
 ErrorCode
 FSBlock::exportBlock(const fs::path &path)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_USERDIR_BLOCK:    return exportUserDirBlock(path);
         case FS_FILEHEADER_BLOCK: return exportFileHeaderBlock(path);
@@ -822,7 +814,7 @@ FSBlock::exportFileHeaderBlock(const fs::path &path)
 FSName
 FSBlock::getName() const
 {
-    switch (type) {
+    switch (type()) {
     
         case FS_ROOT_BLOCK:
         case FS_USERDIR_BLOCK:
@@ -838,7 +830,9 @@ FSBlock::getName() const
 void
 FSBlock::setName(FSName name)
 {
-    switch (type) {
+    invalidate();
+
+    switch (type()) {
     
         case FS_ROOT_BLOCK:
         case FS_USERDIR_BLOCK:
@@ -854,7 +848,7 @@ FSBlock::setName(FSName name)
 bool
 FSBlock::isNamed(FSName &other) const
 {
-    switch (type) {
+    switch (type()) {
     
         case FS_ROOT_BLOCK:
         case FS_USERDIR_BLOCK:
@@ -871,7 +865,7 @@ FSBlock::isNamed(FSName &other) const
 FSComment
 FSBlock::getComment() const
 {
-    switch (type) {
+    switch (type()) {
     
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -887,7 +881,9 @@ FSBlock::getComment() const
 void
 FSBlock::setComment(FSComment name)
 {
-    switch (type) {
+    invalidate();
+
+    switch (type()) {
     
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -903,7 +899,7 @@ FSBlock::setComment(FSComment name)
 FSTime
 FSBlock::getCreationDate() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
             
@@ -922,7 +918,9 @@ FSBlock::getCreationDate() const
 void
 FSBlock::setCreationDate(FSTime t)
 {
-    switch (type) {
+    invalidate();
+
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
 
@@ -943,7 +941,7 @@ FSBlock::setCreationDate(FSTime t)
 FSTime
 FSBlock::getModificationDate() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
             
@@ -957,7 +955,9 @@ FSBlock::getModificationDate() const
 void
 FSBlock::setModificationDate(FSTime t)
 {
-    switch (type) {
+    invalidate();
+
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
             
@@ -972,7 +972,7 @@ FSBlock::setModificationDate(FSTime t)
 u32
 FSBlock::getProtectionBits() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -987,7 +987,7 @@ FSBlock::getProtectionBits() const
 void
 FSBlock::setProtectionBits(u32 val)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1003,7 +1003,7 @@ FSBlock::setProtectionBits(u32 val)
 u32
 FSBlock::getFileSize() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILEHEADER_BLOCK:
 
@@ -1017,7 +1017,7 @@ FSBlock::getFileSize() const
 void
 FSBlock::setFileSize(u32 val)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILEHEADER_BLOCK:
 
@@ -1032,7 +1032,7 @@ FSBlock::setFileSize(u32 val)
 Block
 FSBlock::getParentDirRef() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1047,7 +1047,7 @@ FSBlock::getParentDirRef() const
 void
 FSBlock::setParentDirRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1070,7 +1070,7 @@ FSBlock::getParentDirBlock()
 Block
 FSBlock::getFileHeaderRef() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILELIST_BLOCK:  return get32(-3);
         case FS_DATA_BLOCK_OFS:  return get32(1);
@@ -1083,7 +1083,7 @@ FSBlock::getFileHeaderRef() const
 void
 FSBlock::setFileHeaderRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILELIST_BLOCK:  set32(-3, ref); break;
         case FS_DATA_BLOCK_OFS:  set32(1, ref); break;
@@ -1103,7 +1103,7 @@ FSBlock::getFileHeaderBlock()
 Block
 FSBlock::getNextHashRef() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1118,7 +1118,7 @@ FSBlock::getNextHashRef() const
 void
 FSBlock::setNextHashRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1141,7 +1141,7 @@ FSBlock::getNextHashBlock()
 Block
 FSBlock::getNextListBlockRef() const
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1156,7 +1156,7 @@ FSBlock::getNextListBlockRef() const
 void
 FSBlock::setNextListBlockRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1179,7 +1179,7 @@ FSBlock::getNextListBlock()
 Block
 FSBlock::getNextBmExtBlockRef() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:        return get32(-24);
         case FS_BITMAP_EXT_BLOCK:  return get32(-1);
@@ -1192,7 +1192,7 @@ FSBlock::getNextBmExtBlockRef() const
 void
 FSBlock::setNextBmExtBlockRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:        set32(-24, ref); break;
         case FS_BITMAP_EXT_BLOCK:  set32(-1, ref); break;
@@ -1212,7 +1212,7 @@ FSBlock::getNextBmExtBlock()
 Block
 FSBlock::getFirstDataBlockRef() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1227,7 +1227,7 @@ FSBlock::getFirstDataBlockRef() const
 void
 FSBlock::setFirstDataBlockRef(Block ref)
 {
-    switch (type) {
+    switch (type()) {
                         
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1250,7 +1250,7 @@ FSBlock::getFirstDataBlock()
 Block
 FSBlock::getDataBlockRef(isize nr) const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1265,7 +1265,7 @@ FSBlock::getDataBlockRef(isize nr) const
 void
 FSBlock::setDataBlockRef(isize nr, Block ref)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1281,13 +1281,13 @@ FSBlock::setDataBlockRef(isize nr, Block ref)
 Block
 FSBlock::getNextDataBlockRef() const
 {
-    return type == FS_DATA_BLOCK_OFS ? get32(4) : 0;
+    return type() == FS_DATA_BLOCK_OFS ? get32(4) : 0;
 }
 
 void
 FSBlock::setNextDataBlockRef(Block ref)
 {
-    if (type == FS_DATA_BLOCK_OFS) set32(4, ref);
+    if (type() == FS_DATA_BLOCK_OFS) set32(4, ref);
 }
 
 FSBlock *
@@ -1300,7 +1300,7 @@ FSBlock::getNextDataBlock()
 isize
 FSBlock::hashTableSize() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
         case FS_USERDIR_BLOCK:
@@ -1315,7 +1315,7 @@ FSBlock::hashTableSize() const
 u32
 FSBlock::hashValue() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_USERDIR_BLOCK:
         case FS_FILEHEADER_BLOCK:
@@ -1344,7 +1344,7 @@ FSBlock::dumpHashTable() const
 {
     for (isize i = 0; i < hashTableSize(); i++) {
         
-        u32 value = read32(data.ptr + 24 + 4 * i);
+        u32 value = read32(data + 24 + 4 * i);
         if (value) {
             msg("%ld: %d ", i, value);
         }
@@ -1355,19 +1355,21 @@ void
 FSBlock::writeBootBlock(BootBlockId id, isize page)
 {
     assert(page == 0 || page == 1);
-    assert(type == FS_BOOT_BLOCK);
+    assert(type() == FS_BOOT_BLOCK);
     
     debug(FS_DEBUG, "writeBootBlock(%s, %ld)\n", BootBlockIdEnum::key(id), page);
     
+    invalidate();
+
     if (id != BB_NONE) {
         
         // Read boot block image from the database
         auto image = BootBlockImage(id);
         
         if (page == 0) {
-            image.write(data.ptr + 4, 4, 511); // Write 508 bytes (skip header)
+            image.write(data + 4, 4, 511); // Write 508 bytes (skip header)
         } else {
-            image.write(data.ptr, 512, 1023);  // Write 512 bytes
+            image.write(data, 512, 1023);  // Write 512 bytes
         }
     }
 }
@@ -1375,7 +1377,7 @@ FSBlock::writeBootBlock(BootBlockId id, isize page)
 bool
 FSBlock::addBitmapBlockRefs(std::vector<Block> &refs)
 {
-    assert(type == FS_ROOT_BLOCK);
+    assert(type() == FS_ROOT_BLOCK);
     
     auto it = refs.begin();
      
@@ -1399,7 +1401,7 @@ void
 FSBlock::addBitmapBlockRefs(std::vector<Block> &refs,
                             std::vector<Block>::iterator &it)
 {
-    assert(type == FS_BITMAP_EXT_BLOCK);
+    assert(type() == FS_BITMAP_EXT_BLOCK);
     
     isize max = (bsize() / 4) - 1;
     
@@ -1412,7 +1414,7 @@ FSBlock::addBitmapBlockRefs(std::vector<Block> &refs,
 Block
 FSBlock::getBmBlockRef(isize nr) const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
             
@@ -1430,7 +1432,7 @@ FSBlock::getBmBlockRef(isize nr) const
 void
 FSBlock::setBmBlockRef(isize nr, Block ref)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_ROOT_BLOCK:
             
@@ -1450,7 +1452,7 @@ FSBlock::setBmBlockRef(isize nr, Block ref)
 u32
 FSBlock::getDataBlockNr() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS: return get32(2); 
         case FS_DATA_BLOCK_FFS: return 0;
@@ -1463,7 +1465,7 @@ FSBlock::getDataBlockNr() const
 void
 FSBlock::setDataBlockNr(u32 val)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS: set32(2, val); break;
         case FS_DATA_BLOCK_FFS: break;
@@ -1482,7 +1484,7 @@ FSBlock::getMaxDataBlockRefs() const
 isize
 FSBlock::getNumDataBlockRefs() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1497,7 +1499,7 @@ FSBlock::getNumDataBlockRefs() const
 void
 FSBlock::setNumDataBlockRefs(u32 val)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1513,7 +1515,7 @@ FSBlock::setNumDataBlockRefs(u32 val)
 void
 FSBlock::incNumDataBlockRefs()
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         case FS_FILELIST_BLOCK:
@@ -1529,7 +1531,7 @@ FSBlock::incNumDataBlockRefs()
 bool
 FSBlock::addDataBlockRef(u32 first, u32 ref)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_FILEHEADER_BLOCK:
         {
@@ -1581,7 +1583,7 @@ FSBlock::addDataBlockRef(u32 first, u32 ref)
 u32
 FSBlock::getDataBytesInBlock() const
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS: return get32(3);
         case FS_DATA_BLOCK_FFS: return 0;
@@ -1594,7 +1596,7 @@ FSBlock::getDataBytesInBlock() const
 void
 FSBlock::setDataBytesInBlock(u32 val)
 {
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS: set32(3, val); break;
         case FS_DATA_BLOCK_FFS: break;
@@ -1611,7 +1613,7 @@ FSBlock::writeData(std::ostream& os)
     // TODO: CALL writeData(Buffer<u8> &) and write Buffer to the stream
     
     // Only call this function for file header blocks
-    assert(type == FS_FILEHEADER_BLOCK);
+    assert(type() == FS_FILEHEADER_BLOCK);
     
     isize bytesRemaining = getFileSize();
     isize bytesTotal = 0;
@@ -1657,16 +1659,16 @@ FSBlock::writeData(std::ostream& os, isize size)
 {
     isize count = std::min(dsize(), size);
     
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS:
             
-            os.write((char *)(data.ptr + 24), count);
+            os.write((char *)(data + 24), count);
             return count;
             
         case FS_DATA_BLOCK_FFS:
             
-            os.write((char *)data.ptr, count);
+            os.write((char *)data, count);
             return count;
             
         default:
@@ -1678,7 +1680,7 @@ isize
 FSBlock::writeData(Buffer<u8> &buf)
 {
     // Only call this function for file header blocks
-    assert(type == FS_FILEHEADER_BLOCK);
+    assert(type() == FS_FILEHEADER_BLOCK);
     
     isize bytesRemaining = getFileSize();
     isize bytesTotal = 0;
@@ -1726,16 +1728,16 @@ FSBlock::writeData(Buffer<u8> &buf, isize offset, isize count)
 {
     count = std::min(dsize(), count);
     
-    switch (type) {
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS:
             
-            std::memcpy((void *)(buf.ptr + offset), (void *)(data.ptr + 24), count);
+            std::memcpy((void *)(buf.ptr + offset), (void *)(data + 24), count);
             return count;
             
         case FS_DATA_BLOCK_FFS:
 
-            std::memcpy((void *)(buf.ptr + offset), (void *)(data.ptr), count);
+            std::memcpy((void *)(buf.ptr + offset), (void *)(data), count);
             return count;
             
         default:
@@ -1747,7 +1749,7 @@ isize
 FSBlock::overwriteData(Buffer<u8> &buf)
 {
     // Only call this function for file header blocks
-    assert(type == FS_FILEHEADER_BLOCK);
+    assert(type() == FS_FILEHEADER_BLOCK);
     
     isize bytesRemaining = getFileSize();
     isize bytesTotal = 0;
@@ -1794,17 +1796,18 @@ isize
 FSBlock::overwriteData(Buffer<u8> &buf, isize offset, isize count)
 {
     count = std::min(dsize(), count);
-    
-    switch (type) {
+    invalidate();
+
+    switch (type()) {
             
         case FS_DATA_BLOCK_OFS:
             
-            std::memcpy((void *)(data.ptr + 24), (void *)(buf.ptr + offset), count);
+            std::memcpy((void *)(data + 24), (void *)(buf.ptr + offset), count);
             return count;
             
         case FS_DATA_BLOCK_FFS:
 
-            std::memcpy((void *)(data.ptr), (void *)(buf.ptr + offset), count);
+            std::memcpy((void *)(data), (void *)(buf.ptr + offset), count);
             return count;
             
         default:
@@ -19,31 +19,30 @@
 
 using util::Buffer;
 
+/* An FSBlock is a lightweight view on a single block of a file system. The
+ * block data and the block metadata are stored in compact arrays owned by
+ * the FileSystem object.
+ */
 struct FSBlock : AmigaObject {
         
     // The device this block belongs to
     class FileSystem &device;
 
-    // The type of this block
-    FSBlockType type = FS_UNKNOWN_BLOCK;
-        
     // The sector number of this block
     Block nr;
     
-    // Outcome of the latest integrity check (0 = OK, n = n-th corrupted block)
-    isize corrupted = 0;
-        
-    // Block data
-    Buffer<u8> data;
+    // Block data (points into the block storage of the device)
+    u8 *data;
 
     
     //
     // Constructing
     //
     
-    FSBlock(FileSystem &ref, Block nr, FSBlockType t);
+    FSBlock(FileSystem &ref, Block nr, u8 *data) : device(ref), nr(nr), data(data) { }
 
-    static FSBlock *make(FileSystem &ref, Block nr, FSBlockType type) throws;
+    // Assigns a new type to this block and initializes the block data
+    void init(FSBlockType t) throws;
 
     
     //
@@ -71,6 +70,12 @@ public:
     // Returns the role of a certain byte in this block
     FSItemType itemType(isize byte) const;
     
+    // Returns the type of this block
+    FSBlockType type() const;
+
+    // Returns the outcome of the latest integrity check (0 = OK, n = n-th corrupted block)
+    isize corrupted() const;
+
     // Returns the type and subtype identifiers of this block
     u32 typeID() const;
     u32 subtypeID() const;
@@ -85,6 +90,9 @@ public:
 
     // Checks the integrity of a certain byte in this block
     ErrorCode check(isize pos, u8 *expected, bool strict) const;
+
+    // Marks the cached integrity verdict as outdated (must be called on modification)
+    void invalidate() const;
         
     
     //
@@ -102,9 +110,9 @@ public:
     
     // Reads, writes, or modifies the n-th long word
     u32 get32(isize n) const { return read32(addr32(n)); }
-    void set32(isize n, u32 val) const { write32(addr32(n), val); }
-    void inc32(isize n) const { inc32(addr32(n)); }
-    void dec32(isize n) const { dec32(addr32(n)); }
+    void set32(isize n, u32 val) const { write32(addr32(n), val); invalidate(); }
+    void inc32(isize n) const { inc32(addr32(n)); invalidate(); }
+    void dec32(isize n) const { dec32(addr32(n)); invalidate(); }
 
     // Returns the location of the checksum inside this block
     isize checksumLocation() const;
@@ -8,16 +8,18 @@
 // -----------------------------------------------------------------------------
 
 #include "config.h"
+#include "Concurrency.h"
 #include "IOUtils.h"
 #include "MutableFileSystem.h"
 #include "MemUtils.h"
+#include <algorithm>
 #include <climits>
 #include <set>
 #include <stack>
 
 FileSystem::~FileSystem()
 {
-    for (auto &b : blocks) delete b;
+    std::free(arena);
 }
 
 void
@@ -83,15 +85,17 @@ FileSystem::init(FileSystemDescriptor layout, u8 *buf, isize len)
     
     // Create all blocks
     assert(blocks.empty());
+    initStorage(layout.numBlocks);
+    
     for (isize i = 0; i < layout.numBlocks; i++) {
         
         const u8 *data = buf + i * bsize;
                 
-        // Determine the type of the new block
+        // Determine the type of the block
         FSBlockType type = predictBlockType((Block)i, data);
         
-        // Create new block
-        blocks.push_back(FSBlock::make(*this, (Block)i, type));
+        // Setup the block
+        blocks[i]->init(type);
 
         // Import block data
         blocks[i]->importBlock(data, bsize);
@@ -105,6 +109,41 @@ FileSystem::init(FileSystemDescriptor layout, u8 *buf, isize len)
     if constexpr (FS_DEBUG) printDirectory(true);
 }
 
+void
+FileSystem::initStorage(isize capacity)
+{
+    assert(capacity >= 0);
+    
+    // Free the old storage (if any)
+    blocks.clear();
+    views.clear();
+    std::free(arena);
+
+    /* Allocate the block data of all blocks in a single chunk. Because the
+     * memory is requested in zeroed state, the operating system can back it
+     * lazily, i.e., unused blocks do not occupy physical memory.
+     */
+    arena = (u8 *)std::calloc(usize(std::max(capacity, isize(1)) * bsize), 1);
+    if (!arena) throw VAError(ERROR_OUT_OF_MEMORY);
+    
+    // Initialize metadata
+    types.assign(capacity, u8(FS_EMPTY_BLOCK));
+    corruptions.assign(capacity, 0);
+    verdicts.assign(capacity, -1);
+    verdictLevel = -1;
+    corruptedBlocks.clear();
+
+    // Create the block objects
+    views.reserve(capacity);
+    blocks.reserve(capacity);
+    
+    for (isize i = 0; i < capacity; i++) {
+        
+        views.push_back(FSBlock(*this, Block(i), arena + i * bsize));
+        blocks.push_back(&views.back());
+    }
+}
+
 void
 FileSystem::_dump(Category category, std::ostream& os) const
 {
@@ -165,10 +204,10 @@ FileSystem::_dump(Category category, std::ostream& os) const
         
         for (isize i = 0; i < numBlocks(); i++)  {
             
-            if (blocks[i]->type == FS_EMPTY_BLOCK) continue;
+            if (blocks[i]->type() == FS_EMPTY_BLOCK) continue;
             
             msg("\nBlock %ld (%d):", i, blocks[i]->nr);
-            msg(" %s\n", FSBlockTypeEnum::key(blocks[i]->type));
+            msg(" %s\n", FSBlockTypeEnum::key(blocks[i]->type()));
             
             blocks[i]->dump();
         }
@@ -229,19 +268,19 @@ FileSystem::getModificationDate() const
 string
 FileSystem::getBootBlockName() const
 {
-    return BootBlockImage(blocks[0]->data.ptr, blocks[1]->data.ptr).name;
+    return BootBlockImage(blocks[0]->data, blocks[1]->data).name;
 }
 
 BootBlockType
 FileSystem::bootBlockType() const
 {
-    return BootBlockImage(blocks[0]->data.ptr, blocks[1]->data.ptr).type;
+    return BootBlockImage(blocks[0]->data, blocks[1]->data).type;
 }
 
 FSBlockType
 FileSystem::blockType(Block nr) const
 {
-    return blockPtr(nr) ? blocks[nr]->type : FS_UNKNOWN_BLOCK;
+    return blockPtr(nr) ? blocks[nr]->type() : FS_UNKNOWN_BLOCK;
 }
 
 FSItemType
@@ -259,7 +298,7 @@ FileSystem::blockPtr(Block nr) const
 FSBlock *
 FileSystem::bootBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_BOOT_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_BOOT_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -268,7 +307,7 @@ FileSystem::bootBlockPtr(Block nr) const
 FSBlock *
 FileSystem::rootBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_ROOT_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_ROOT_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -277,7 +316,7 @@ FileSystem::rootBlockPtr(Block nr) const
 FSBlock *
 FileSystem::bitmapBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_BITMAP_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_BITMAP_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -286,7 +325,7 @@ FileSystem::bitmapBlockPtr(Block nr) const
 FSBlock *
 FileSystem::bitmapExtBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_BITMAP_EXT_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_BITMAP_EXT_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -295,7 +334,7 @@ FileSystem::bitmapExtBlockPtr(Block nr) const
 FSBlock *
 FileSystem::userDirBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_USERDIR_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_USERDIR_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -304,7 +343,7 @@ FileSystem::userDirBlockPtr(Block nr) const
 FSBlock *
 FileSystem::fileHeaderBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_FILEHEADER_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_FILEHEADER_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -313,7 +352,7 @@ FileSystem::fileHeaderBlockPtr(Block nr) const
 FSBlock *
 FileSystem::fileListBlockPtr(Block nr) const
 {
-    if (nr < blocks.size() && blocks[nr]->type == FS_FILELIST_BLOCK) {
+    if (nr < blocks.size() && blocks[nr]->type() == FS_FILELIST_BLOCK) {
         return blocks[nr];
     }
     return nullptr;
@@ -322,7 +361,7 @@ FileSystem::fileListBlockPtr(Block nr) const
 FSBlock *
 FileSystem::dataBlockPtr(Block nr) const
 {
-    FSBlockType t = nr < blocks.size() ? blocks[nr]->type : FS_UNKNOWN_BLOCK;
+    FSBlockType t = nr < blocks.size() ? blocks[nr]->type() : FS_UNKNOWN_BLOCK;
 
     if (t == FS_DATA_BLOCK_OFS || t == FS_DATA_BLOCK_FFS) {
         return blocks[nr];
@@ -333,7 +372,7 @@ FileSystem::dataBlockPtr(Block nr) const
 FSBlock *
 FileSystem::hashableBlockPtr(Block nr) const
 {
-    FSBlockType t = nr < blocks.size() ? blocks[nr]->type : FS_UNKNOWN_BLOCK;
+    FSBlockType t = nr < blocks.size() ? blocks[nr]->type() : FS_UNKNOWN_BLOCK;
     
     if (t == FS_USERDIR_BLOCK || t == FS_FILEHEADER_BLOCK) {
         return blocks[nr];
@@ -347,7 +386,7 @@ FileSystem::readByte(Block nr, isize offset) const
     assert(offset < bsize);
 
     if (isize(nr) < numBlocks()) {
-        return blocks[nr]->data.ptr ? blocks[nr]->data[offset] : 0;
+        return blocks[nr]->type() != FS_EMPTY_BLOCK ? blocks[nr]->data[offset] : 0;
     }
     
     return 0;
@@ -359,8 +398,8 @@ FileSystem::ascii(Block nr, isize offset, isize len) const
     assert(isBlockNumber(nr));
     assert(offset + len <= bsize);
     
-    if (blocks[nr]->data.ptr) {
-        return util::createAscii(blocks[nr]->data.ptr + offset, len);
+    if (blocks[nr]->type() != FS_EMPTY_BLOCK) {
+        return util::createAscii(blocks[nr]->data + offset, len);
     } else {
         return string(len, '.');
     }
@@ -435,7 +474,7 @@ FileSystem::currentDirBlock()
     FSBlock *cdb = blockPtr(cd);
     
     if (cdb) {
-        if (cdb->type == FS_ROOT_BLOCK || cdb->type == FS_USERDIR_BLOCK) {
+        if (cdb->type() == FS_ROOT_BLOCK || cdb->type() == FS_USERDIR_BLOCK) {
             return cdb;
         }
     }
@@ -649,29 +688,63 @@ FileSystem::check(bool strict) const
 
     isize total = 0, min = INT_MAX, max = 0;
     
-    // Analyze the allocation table
-    for (isize i = 0; i < numBlocks(); i++) {
+    // Discard all cached verdicts if the strictness level has changed
+    if (verdictLevel != isize(strict)) {
+        std::fill(verdicts.begin(), verdicts.end(), -1);
+        verdictLevel = isize(strict);
+    }
 
-        FSBlock *block = blocks[i];
-        if (block->type == FS_EMPTY_BLOCK && !isFree(Block(i))) {
-            result.bitmapErrors++;
-            debug(FS_DEBUG, "Empty block %ld is marked as allocated\n", i);
-        }
-        if (block->type != FS_EMPTY_BLOCK && isFree(Block(i))) {
-            result.bitmapErrors++;
-            debug(FS_DEBUG, "Non-empty block %ld is marked as free\n", i);
+    // The checksum of the first boot block covers the second one
+    if (numBlocks() > 1 && verdicts[1] < 0) verdicts[0] = -1;
+
+    /* Analyze the allocation table and all blocks. Large volumes are split
+     * into slices which are processed in parallel. The checker only reads
+     * from the block storage and each slice writes to its own blocks only.
+     * Blocks with a clean verdict which haven't been modified since the last
+     * run are skipped. Corrupted blocks are always reanalyzed, because their
+     * verdict may depend on the types of other blocks. If the type of a block
+     * changes, all verdicts are discarded (see FSBlock::init()).
+     */
+    isize slices = numBlocks() < 0x4000 ? 1 : 64;
+    std::vector<isize> bitmapErrors(slices);
+    
+    auto analyze = [&](isize slice) {
+        
+        isize first = numBlocks() * slice / slices;
+        isize last = numBlocks() * (slice + 1) / slices;
+        
+        for (isize i = first; i < last; i++) {
+            
+            FSBlock *block = blocks[i];
+            if (block->type() == FS_EMPTY_BLOCK && !isFree(Block(i))) {
+                bitmapErrors[slice]++;
+                debug(FS_DEBUG, "Empty block %ld is marked as allocated\n", i);
+            }
+            if (block->type() != FS_EMPTY_BLOCK && isFree(Block(i))) {
+                bitmapErrors[slice]++;
+                debug(FS_DEBUG, "Non-empty block %ld is marked as free\n", i);
+            }
+            if (verdicts[i] != 0) {
+                verdicts[i] = i16(block->check(strict));
+            }
         }
-    }
+    };
+    
+    util::parallelFor(slices, analyze);
+    
+    // Merge the results in block order to keep the numbering deterministic
+    for (isize i = 0; i < slices; i++) result.bitmapErrors += bitmapErrors[i];
+    corruptedBlocks.clear();
 
-    // Analyze all blocks
     for (isize i = 0; i < numBlocks(); i++) {
 
-        if (blocks[i]->check(strict) > 0) {
+        if (verdicts[i] > 0) {
             min = std::min(min, i);
             max = std::max(max, i);
-            blocks[i]->corrupted = ++total;
+            corruptions[i] = u32(++total);
+            corruptedBlocks.push_back(Block(i));
         } else {
-            blocks[i]->corrupted = 0;
+            corruptions[i] = 0;
         }
     }
 
@@ -695,6 +768,13 @@ FileSystem::check(Block nr, isize pos, u8 *expected, bool strict) const
     return blocks[nr]->check(pos, expected, strict);
 }
 
+void
+FileSystem::invalidateVerdicts()
+{
+    // The verdicts are discarded lazily by the next call to check()
+    verdictLevel = -1;
+}
+
 ErrorCode
 FileSystem::checkBlockType(Block nr, FSBlockType type) const
 {
@@ -730,7 +810,7 @@ FileSystem::checkBlockType(Block nr, FSBlockType type, FSBlockType altType) cons
 isize
 FileSystem::getCorrupted(Block nr)
 {
-    return blockPtr(nr) ? blocks[nr]->corrupted : 0;
+    return blockPtr(nr) ? blocks[nr]->corrupted() : 0;
 }
 
 bool
@@ -842,8 +922,8 @@ FileSystem::getDisplayType(isize column)
         for (isize i = 0; i < numBlocks(); i++) {
                         
             auto pos = i * (width - 1) / (numBlocks() - 1);
-            if (pri[cache[pos]] < pri[blocks[i]->type]) {
-                cache[pos] = blocks[i]->type;
+            if (pri[cache[pos]] < pri[blocks[i]->type()]) {
+                cache[pos] = blocks[i]->type();
             }
         }
         
@@ -875,14 +955,15 @@ FileSystem::diagnoseImageSlice(isize column)
         for (isize i = 0; i < width; i++) cache[i] = -1;
                 
         // Compute values
+        isize n = std::max(numBlocks() - 1, isize(1));
         for (isize i = 0; i < numBlocks(); i++) {
 
-            auto pos = i * width / (numBlocks() - 1);
-            if (blocks[i]->corrupted) {
+            auto pos = std::min(i * width / n, width - 1);
+            if (blocks[i]->corrupted()) {
                 cache[pos] = 2;
-            } else if (blocks[i]->type == FS_UNKNOWN_BLOCK) {
+            } else if (blocks[i]->type() == FS_UNKNOWN_BLOCK) {
                 cache[pos] = 0;
-            } else if (blocks[i]->type == FS_EMPTY_BLOCK) {
+            } else if (blocks[i]->type() == FS_EMPTY_BLOCK) {
                 cache[pos] = 0;
             } else {
                 cache[pos] = 1;
@@ -911,7 +992,7 @@ FileSystem::nextBlockOfType(FSBlockType type, isize after)
     
     do {
         result = (result + 1) % numBlocks();
-        if (blocks[result]->type == type) return result;
+        if (blocks[result]->type() == type) return result;
         
     } while (result != after);
     
@@ -923,13 +1004,15 @@ FileSystem::nextCorruptedBlock(isize after)
 {
     assert(isBlockNumber(after));
     
-    isize result = after;
+    // Search the corrupted block list recorded by the latest check
+    auto next = std::upper_bound(corruptedBlocks.begin(), corruptedBlocks.end(), Block(after));
     
-    do {
-        result = (result + 1) % numBlocks();
-        if (blocks[result]->corrupted) return result;
-        
-    } while (result != after);
+    for (auto it = next; it != corruptedBlocks.end(); it++) {
+        if (blocks[*it]->corrupted()) return isize(*it);
+    }
+    for (auto it = corruptedBlocks.begin(); it != next; it++) {
+        if (blocks[*it]->corrupted()) return isize(*it);
+    }
     
     return -1;
 }
@@ -42,8 +42,23 @@ protected:
     // File system version
     FSVolumeType dos = FS_NODOS;
     
-    // Block storage
+    // Block storage (references to the elements of 'views')
     std::vector<BlockPtr> blocks;
+
+    // Lightweight block objects (one contiguous allocation)
+    std::vector<FSBlock> views;
+
+    // Block data of all blocks (one contiguous allocation, owned by this object)
+    u8 *arena = nullptr;
+
+    // Block types
+    std::vector<u8> types;
+
+    // Outcome of the latest integrity check (0 = OK, n = n-th corrupted block)
+    mutable std::vector<u32> corruptions;
+
+    // Cached results of FSBlock::check(strict) (number of errors, -1 = outdated)
+    mutable std::vector<i16> verdicts;
             
     // Size of a single block in bytes
     isize bsize = 512;
@@ -60,6 +75,12 @@ protected:
         
     // The currently selected directory (reference to FSDirBlock)
     Block cd = 0;
+
+    // Strictness level of the cached block verdicts (-1 = nothing cached)
+    mutable isize verdictLevel = -1;
+
+    // Sorted list of all blocks found corrupted by the latest check
+    mutable std::vector<Block> corruptedBlocks;
     
     
     //
@@ -73,6 +94,8 @@ public:
     FileSystem(const HDFFile &hdn, isize part) throws { init(hdn, part); }
     FileSystem(FloppyDrive &dfn) throws { init(dfn); }
     FileSystem(const HardDrive &hdn, isize part) throws { init(hdn, part); }
+    FileSystem(const FileSystem&) = delete;
+    FileSystem& operator=(const FileSystem&) = delete;
 
     virtual ~FileSystem();
     
@@ -85,6 +108,9 @@ protected:
 
     void init(FileSystemDescriptor layout, u8 *buf, isize len) throws;
 
+    // Allocates the block storage (all blocks are initialized as empty)
+    void initStorage(isize capacity) throws;
+
     
     //
     // Methods from AmigaObject
@@ -220,6 +246,9 @@ public:
     // Checks a single byte in a certain block
     ErrorCode check(Block nr, isize pos, u8 *expected, bool strict) const;
 
+    // Discards all cached block verdicts
+    void invalidateVerdicts();
+
     // Checks if the block with the given number is part of the volume
     bool isBlockNumber(isize nr) const { return nr >= 0 && nr < numBlocks(); }
 
@@ -305,3 +334,11 @@ public:
     // Searches the block list for a corrupted block
     isize nextCorruptedBlock(isize after);
 };
+
+//
+// Inline accessors of FSBlock (depend on the storage layout of FileSystem)
+//
+
+inline FSBlockType FSBlock::type() const { return FSBlockType(device.types[nr]); }
+inline isize FSBlock::corrupted() const { return isize(device.corruptions[nr]); }
+inline void FSBlock::invalidate() const { device.verdicts[nr] = -1; }
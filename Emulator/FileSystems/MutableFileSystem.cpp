@@ -18,24 +18,19 @@
 void
 MutableFileSystem::init(isize capacity)
 {
-    // Remove existing blocks (if any)
-    for (auto &b : blocks) delete b;
-    
     // Resize and initialize the block storage
-    blocks.reserve(capacity);
-    blocks.assign(capacity, nullptr);
+    initStorage(capacity);
 }
 
 void
 MutableFileSystem::init(FileSystemDescriptor &layout)
 {
-    init((isize)layout.numBlocks);
-    
     if constexpr (FS_DEBUG) { layout.dump(); }
     
     // Copy layout parameters
-    dos         = layout.dos;
     bsize       = layout.bsize;
+    init((isize)layout.numBlocks);
+    dos         = layout.dos;
     numReserved = layout.numReserved;
     rootBlock   = layout.rootBlock;
     bmBlocks    = layout.bmBlocks;
@@ -47,9 +42,6 @@ MutableFileSystem::init(FileSystemDescriptor &layout)
     // Set the current directory to '/'
     cd = rootBlock;
     
-    // Do some consistency checking
-    for (isize i = 0; i < numBlocks(); i++) assert(blocks[i] != nullptr);
-    
     // Print some debug information
     if constexpr (FS_DEBUG) { dump(Category::Summary); }
 }
@@ -107,28 +99,28 @@ MutableFileSystem::format(string name)
 
     // Do some consistency checking
     assert(numBlocks() > 2);
-    for (isize i = 0; i < numBlocks(); i++) assert(blocks[i] == nullptr);
+    for (isize i = 0; i < numBlocks(); i++) assert(blocks[i]->type() == FS_EMPTY_BLOCK);
 
     // Create boot blocks
-    blocks[0] = new FSBlock(*this, 0, FS_BOOT_BLOCK);
-    blocks[1] = new FSBlock(*this, 1, FS_BOOT_BLOCK);
+    blocks[0]->init(FS_BOOT_BLOCK);
+    blocks[1]->init(FS_BOOT_BLOCK);
 
     // Create the root block
     assert(rootBlock != 0);
-    FSBlock *rb = new FSBlock(*this, rootBlock, FS_ROOT_BLOCK);
-    blocks[rootBlock] = rb;
+    FSBlock *rb = blocks[rootBlock];
+    rb->init(FS_ROOT_BLOCK);
     
     // Create bitmap blocks
     for (auto& ref : bmBlocks) {
         
-        blocks[ref] = new FSBlock(*this, ref, FS_BITMAP_BLOCK);
+        blocks[ref]->init(FS_BITMAP_BLOCK);
     }
     
     // Add bitmap extension blocks
     FSBlock *pred = rb;
     for (auto& ref : bmExtBlocks) {
         
-        blocks[ref] = new FSBlock(*this, ref, FS_BITMAP_EXT_BLOCK);
+        blocks[ref]->init(FS_BITMAP_EXT_BLOCK);
         pred->setNextBmExtBlockRef(ref);
         pred = blocks[ref];
     }
@@ -136,11 +128,10 @@ MutableFileSystem::format(string name)
     // Add all bitmap block references
     rb->addBitmapBlockRefs(bmBlocks);
     
-    // Add free blocks
+    // Mark all remaining blocks as free
     for (isize i = 0; i < numBlocks(); i++) {
         
-        if (blocks[i] == nullptr) {
-            blocks[i] = new FSBlock(*this, Block(i), FS_EMPTY_BLOCK);
+        if (blocks[i]->type() == FS_EMPTY_BLOCK) {
             markAsFree(Block(i));
         }
     }
@@ -218,7 +209,7 @@ MutableFileSystem::allocateBlockAbove(Block nr)
     
     for (isize i = nr + 1; i < numBlocks(); i++) {
         
-        if (blocks[i]->type == FS_EMPTY_BLOCK) {
+        if (blocks[i]->type() == FS_EMPTY_BLOCK) {
             
             markAsAllocated(Block(i));
             return (Block(i));
@@ -234,7 +225,7 @@ MutableFileSystem::allocateBlockBelow(Block nr)
 
     for (i64 i = (i64)nr - 1; i >= 0; i--) {
         
-        if (blocks[i]->type == FS_EMPTY_BLOCK) {
+        if (blocks[i]->type() == FS_EMPTY_BLOCK) {
             
             markAsAllocated(Block(i));
             return (Block(i));
@@ -249,9 +240,11 @@ MutableFileSystem::deallocateBlock(Block nr)
     assert(isBlockNumber(nr));
     assert(blocks[nr]);
     
-    delete blocks[nr];
-    blocks[nr] = new FSBlock(*this, nr, FS_EMPTY_BLOCK);
+    blocks[nr]->init(FS_EMPTY_BLOCK);
     markAsFree(nr);
+
+    // Blocks referring to the deleted block may have turned invalid
+    invalidateVerdicts();
 }
 
 Block
@@ -263,7 +256,7 @@ MutableFileSystem::addFileListBlock(Block head, Block prev)
     Block nr = allocateBlock();
     if (!nr) return 0;
     
-    blocks[nr] = new FSBlock(*this, nr, FS_FILELIST_BLOCK);
+    blocks[nr]->init(FS_FILELIST_BLOCK);
     blocks[nr]->setFileHeaderRef(head);
     prevBlock->setNextListBlockRef(nr);
     
@@ -279,14 +272,9 @@ MutableFileSystem::addDataBlock(isize count, Block head, Block prev)
     Block nr = allocateBlock();
     if (!nr) return 0;
 
-    FSBlock *newBlock;
-    if (isOFS()) {
-        newBlock = new FSBlock(*this, nr, FS_DATA_BLOCK_OFS);
-    } else {
-        newBlock = new FSBlock(*this, nr, FS_DATA_BLOCK_FFS);
-    }
+    FSBlock *newBlock = blocks[nr];
+    newBlock->init(isOFS() ? FS_DATA_BLOCK_OFS : FS_DATA_BLOCK_FFS);
     
-    blocks[nr] = newBlock;
     newBlock->setDataBlockNr((Block)count);
     newBlock->setFileHeaderRef(head);
     prevBlock->setNextDataBlockRef(nr);
@@ -301,9 +289,9 @@ MutableFileSystem::newUserDirBlock(const string &name)
     
     if (Block nr = allocateBlock()) {
     
-        block = new FSBlock(*this, nr, FS_USERDIR_BLOCK);
+        block = blocks[nr];
+        block->init(FS_USERDIR_BLOCK);
         block->setName(FSName(name));
-        blocks[nr] = block;
     }
     
     return block;
@@ -316,9 +304,9 @@ MutableFileSystem::newFileHeaderBlock(const string &name)
     
     if (Block nr = allocateBlock()) {
 
-        block = new FSBlock(*this, nr, FS_FILEHEADER_BLOCK);
+        block = blocks[nr];
+        block->init(FS_FILEHEADER_BLOCK);
         block->setName(FSName(name));
-        blocks[nr] = block;
     }
     
     return block;
@@ -335,8 +323,8 @@ MutableFileSystem::updateChecksums()
 void
 MutableFileSystem::makeBootable(BootBlockId id)
 {
-    assert(blocks[0]->type == FS_BOOT_BLOCK);
-    assert(blocks[1]->type == FS_BOOT_BLOCK);
+    assert(blocks[0]->type() == FS_BOOT_BLOCK);
+    assert(blocks[1]->type() == FS_BOOT_BLOCK);
 
     blocks[0]->writeBootBlock(id, 0);
     blocks[1]->writeBootBlock(id, 1);
@@ -345,8 +333,8 @@ MutableFileSystem::makeBootable(BootBlockId id)
 void
 MutableFileSystem::killVirus()
 {
-    assert(blocks[0]->type == FS_BOOT_BLOCK);
-    assert(blocks[1]->type == FS_BOOT_BLOCK);
+    assert(blocks[0]->type() == FS_BOOT_BLOCK);
+    assert(blocks[1]->type() == FS_BOOT_BLOCK);
 
     auto id = isOFS() ? BB_AMIGADOS_13 : isFFS() ? BB_AMIGADOS_20 : BB_NONE;
 
@@ -354,8 +342,10 @@ MutableFileSystem::killVirus()
         blocks[0]->writeBootBlock(id, 0);
         blocks[1]->writeBootBlock(id, 1);
     } else {
-        std::memset(blocks[0]->data.ptr + 4, 0, bsize - 4);
-        std::memset(blocks[1]->data.ptr, 0, bsize);
+        std::memset(blocks[0]->data + 4, 0, bsize - 4);
+        std::memset(blocks[1]->data, 0, bsize);
+        blocks[0]->invalidate();
+        blocks[1]->invalidate();
     }
 }
 
@@ -366,6 +356,7 @@ MutableFileSystem::setAllocationBit(Block nr, bool value)
     
     if (FSBlock *bm = locateAllocationBit(nr, &byte, &bit)) {
         REPLACE_BIT(bm->data[byte], bit, value);
+        bm->invalidate();
     }
 }
 
@@ -403,7 +394,7 @@ MutableFileSystem::createFile(const string &name, const u8 *buf, isize size)
     FSBlock *block = createFile(name);
     
     if (block) {
-        assert(block->type == FS_FILEHEADER_BLOCK);
+        assert(block->type() == FS_FILEHEADER_BLOCK);
         addData(*block, buf, size);
     }
     
@@ -448,7 +439,7 @@ MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size)
 {
     auto nr = block.nr;
     
-    switch (block.type) {
+    switch (block.type()) {
             
         case FS_FILEHEADER_BLOCK:
         {
@@ -497,7 +488,8 @@ MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size)
         {
             isize count = std::min(bsize - 24, size);
 
-            std::memcpy(block.data.ptr + 24, buffer, count);
+            std::memcpy(block.data + 24, buffer, count);
+            block.invalidate();
             block.setDataBytesInBlock((u32)count);
             
             return count;
@@ -506,7 +498,8 @@ MutableFileSystem::addData(FSBlock &block, const u8 *buffer, isize size)
         {
             isize count = std::min(bsize, size);
             
-            std::memcpy(block.data.ptr, buffer, count);
+            std::memcpy(block.data, buffer, count);
+            block.invalidate();
             
             return count;
         }
@@ -536,19 +529,14 @@ MutableFileSystem::importVolume(const u8 *src, isize size)
         
         const u8 *data = src + i * bsize;
                 
-        // Determine the type of the new block
+        // Determine the type of the block
         FSBlockType type = predictBlockType((Block)i, data);
         
-        // Create new block
-        FSBlock *newBlock = FSBlock::make(*this, (Block)i, type);
+        // Setup the block
+        blocks[i]->init(type);
 
         // Import block data
-        newBlock->importBlock(data, bsize);
-
-        // Replace the existing block
-        assert(blocks[i] != nullptr);
-        delete blocks[i];
-        blocks[i] = newBlock;
+        blocks[i]->importBlock(data, bsize);
     }
     
     // Print some debug information
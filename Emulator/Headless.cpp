@@ -10,21 +10,43 @@
 #include "config.h"
 #include "Headless.h"
 #include "Script.h"
+#include "Checksum.h"
+#include "Snapshot.h"
+#include <csignal>
+#include <fcntl.h>
 #include <getopt.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#endif
+
+extern char **environ;
 
 int main(int argc, char *argv[])
 {
     try {
         
-        Headless().main(argc, argv);
+        return Headless().main(argc, argv);
         
     } catch (SyntaxError &e) {
         
         std::cout << "Usage: ";
-        std::cout << "vAmigaCore [-vm] <script>" << std::endl;
+        std::cout << "vAmigaCore [-vm] [-j <n>] <script> [<script> ...]" << std::endl;
+        std::cout << "       vAmigaCore [-vm] [-r <snapshot>] -c | -s <path> [-f] [<script>]" << std::endl;
         std::cout << std::endl;
         std::cout << "       -v or --verbose   Print executed script lines" << std::endl;
         std::cout << "       -m or --messages  Observe the message queue" << std::endl;
+        std::cout << "       -j or --jobs      Number of parallel worker processes" << std::endl;
+        std::cout << "       -c or --control   Accept control commands via stdin" << std::endl;
+        std::cout << "       -s or --socket    Accept control commands via a socket" << std::endl;
+        std::cout << "       -f or --fork      Serve each client in a forked process" << std::endl;
+        std::cout << "       -r or --restore   Restore a snapshot before serving" << std::endl;
         std::cout << std::endl;
         
         if (auto what = string(e.what()); !what.empty()) {
@@ -48,25 +70,38 @@ int main(int argc, char *argv[])
     } catch (...) {
     
         std::cout << "Error" << std::endl;
+        return 1;
     }
-    
-    return 0;
 }
 
-void
+int
 Headless::main(int argc, char *argv[])
 {
+    // Parse all command line arguments
+    parseArguments(argc, argv);
+
+    // Run in control mode if requested
+    if (keys.find("control") != keys.end() || keys.find("socket") != keys.end()) {
+        return runControl();
+    }
+
     std::cout << "vAmiga Headless v" << amiga.version();
     std::cout << " - (C)opyright Dirk W. Hoffmann" << std::endl << std::endl;
 
-    // Parse all command line arguments
-    parseArguments(argc, argv);
+    // Run in batch mode if more than one script is given
+    if (keys.find("arg2") != keys.end()) return runBatch();
+
+    return runScript(keys["arg1"]);
+}
 
+int
+Headless::runScript(const string &path)
+{
     // Redirect shell output to the console in verbose mode
     if (keys.find("verbose") != keys.end()) amiga.retroShell.setStream(std::cout);
 
     // Read the input script
-    Script script(keys["arg1"]);
+    Script script(path);
     
     // Register message receiver
     amiga.msgQueue.setListener(this, ::process);
@@ -80,6 +115,443 @@ Headless::main(int argc, char *argv[])
         barrier.lock();
         amiga.retroShell.continueScript();
     }
+
+    return returnCode;
+}
+
+int
+Headless::runBatch()
+{
+    std::vector<string> scripts;
+    for (isize nr = 1; keys.find("arg" + std::to_string(nr)) != keys.end(); nr++) {
+        scripts.push_back(keys["arg" + std::to_string(nr)]);
+    }
+    
+    isize jobs = std::thread::hardware_concurrency();
+    if (keys.find("jobs") != keys.end()) jobs = std::stol(keys["jobs"]);
+    jobs = std::max(jobs, isize(1));
+
+    // Silence the workers unless the user wants to see their output
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (keys.find("verbose") == keys.end() && keys.find("messages") == keys.end()) {
+        posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+    }
+
+    std::map<pid_t, string> running;
+    isize next = 0, failed = 0;
+
+    while (next < isize(scripts.size()) || !running.empty()) {
+
+        // Launch workers until all slots are occupied
+        while (next < isize(scripts.size()) && isize(running.size()) < jobs) {
+
+            // Each worker is an instance of this executable running one script
+            std::vector<string> args = { keys["exec"] };
+            if (keys.find("verbose") != keys.end()) args.push_back("-v");
+            if (keys.find("messages") != keys.end()) args.push_back("-m");
+            args.push_back(scripts[next]);
+
+            std::vector<char *> argv;
+            for (auto &arg : args) argv.push_back(arg.data());
+            argv.push_back(nullptr);
+
+            pid_t pid;
+            if (posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ)) {
+
+                std::cout << "[FAIL] " << scripts[next] << " (can't launch worker)" << std::endl;
+                failed++;
+
+            } else {
+
+                running[pid] = scripts[next];
+            }
+            next++;
+        }
+        if (running.empty()) continue;
+
+        // Wait for a worker to finish
+        int status;
+        pid_t pid = wait(&status);
+        if (pid == -1) break;
+
+        auto code = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+        if (code) failed++;
+
+        std::cout << (code ? "[FAIL] " : "[ OK ] ") << running[pid];
+        if (code) std::cout << " (exit code " << code << ")";
+        std::cout << std::endl;
+
+        running.erase(pid);
+    }
+
+    posix_spawn_file_actions_destroy(&actions);
+
+    std::cout << std::endl << scripts.size() - failed << " of " << scripts.size();
+    std::cout << " scripts passed" << std::endl;
+
+    return failed ? 1 : 0;
+}
+
+static bool
+readAll(int fd, u8 *buf, isize len)
+{
+    while (len > 0) {
+
+        auto n = read(fd, buf, len);
+        if (n <= 0) return false;
+        buf += n; len -= n;
+    }
+    return true;
+}
+
+static bool
+writeAll(int fd, const u8 *buf, isize len)
+{
+    while (len > 0) {
+
+        auto n = write(fd, buf, len);
+        if (n <= 0) return false;
+        buf += n; len -= n;
+    }
+    return true;
+}
+
+static void
+append64(vector<u8> &buf, u64 value)
+{
+    auto pos = buf.size();
+    buf.resize(pos + 8);
+    W32BE(buf.data() + pos, u32(value >> 32));
+    W32BE(buf.data() + pos + 4, u32(value));
+}
+
+int
+Headless::runControl()
+{
+    auto in = STDIN_FILENO;
+    auto out = STDOUT_FILENO;
+
+    // Keep the protocol stream free of any other output
+    if (keys.find("socket") == keys.end()) {
+
+        std::cout.flush();
+        out = dup(STDOUT_FILENO);
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+    }
+
+    // Register message receiver
+    amiga.msgQueue.setListener(this, ::process);
+
+    // Set up the emulator by running the provided script
+    if (keys.find("arg1") != keys.end()) {
+        if (auto code = runScript(keys["arg1"]); code) return code;
+    }
+
+    // Warm up the emulator by restoring the provided snapshot
+    if (keys.find("restore") != keys.end()) {
+
+        Snapshot snapshot(keys["restore"]);
+
+        if (amiga.isPoweredOff()) amiga.powerOn();
+        amiga.loadSnapshot(snapshot);
+    }
+
+    // From now on, the emulator is stepped by the client
+    if (amiga.isRunning()) amiga.pause();
+
+    if (keys.find("socket") != keys.end()) {
+
+        auto path = keys["socket"];
+
+        sockaddr_un address = { };
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        auto server = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (server == -1) throw VAError(ERROR_SOCK_CANT_CREATE);
+
+        unlink(path.c_str());
+        if (bind(server, (sockaddr *)&address, sizeof(address)) == -1) {
+            throw VAError(ERROR_SOCK_CANT_BIND, path);
+        }
+        if (listen(server, 16) == -1) {
+            throw VAError(ERROR_SOCK_CANT_LISTEN, path);
+        }
+
+        if (keys.find("fork") != keys.end()) {
+
+            // Shut down all threads that would leave stale locks in a child
+            for (auto server : amiga.remoteManager.servers) server->stop();
+            if (amiga.denise.screenRecorder.isRecording()) {
+                throw VAError(ERROR_REC_LAUNCH, "Fork mode is unavailable while recording.");
+            }
+
+            // Let the system reap terminated child processes
+            signal(SIGCHLD, SIG_IGN);
+        }
+
+        // Serve one client after another until a client sends Quit
+        for (bool quit = false; !quit;) {
+
+            auto client = accept(server, nullptr, nullptr);
+            if (client == -1) break;
+
+            if (keys.find("fork") != keys.end()) {
+
+                /* In fork mode, each client is served by a child process
+                 * operating on a copy-on-write image of the warmed-up
+                 * emulator. The child only consists of the calling thread.
+                 * Hence, it must not terminate regularly, because the
+                 * destructors would try to shut down threads that only
+                 * exist in the parent process. To make sure the child
+                 * doesn't inherit a lock held by the emulator thread, the
+                 * process is forked while the emulator thread is parked.
+                 * Pending output is flushed beforehand to prevent the child
+                 * from writing it a second time.
+                 */
+                pid_t pid = -1;
+                amiga.freeze([&]() {
+
+                    std::cout.flush();
+                    std::cerr.flush();
+                    fflush(nullptr);
+                    pid = fork();
+                });
+
+                if (pid == 0) {
+
+                    forked = true;
+                    close(server);
+                    serveControl(client, client);
+                    _exit(0);
+                }
+
+                close(client);
+                continue;
+            }
+
+            quit = serveControl(client, client);
+            close(client);
+        }
+
+        close(server);
+        unlink(path.c_str());
+
+    } else {
+
+        serveControl(in, out);
+        close(out);
+    }
+
+    return returnCode;
+}
+
+bool
+Headless::serveControl(int in, int out)
+{
+    vector<u8> request, response;
+    u8 header[8];
+
+    while (readAll(in, header, 8)) {
+
+        auto cmd = ControlCmd(R32BE(header));
+        auto len = isize(R32BE(header + 4));
+
+        // Receive the payload (drop the connection if it doesn't fit)
+        try { request.resize(len); } catch (std::exception &) { break; }
+        if (!readAll(in, request.data(), len)) break;
+
+        // Execute the command
+        ErrorCode status = ERROR_OK;
+        response.resize(8);
+
+        try {
+
+            execControl(cmd, request, response);
+
+        } catch (VAError &error) {
+
+            status = ErrorCode(error.data);
+            response.resize(8);
+
+        } catch (std::exception &) {
+
+            status = ERROR_UNKNOWN;
+            response.resize(8);
+        }
+
+        // Send the response in one go
+        W32BE(response.data(), u32(status));
+        W32BE(response.data() + 4, u32(response.size() - 8));
+        if (!writeAll(out, response.data(), isize(response.size()))) break;
+
+        if (cmd == ControlCmd::Quit) return true;
+    }
+
+    return false;
+}
+
+void
+Headless::execControl(ControlCmd cmd, vector<u8> &request, vector<u8> &response)
+{
+    auto args = request.data();
+    auto size = isize(request.size());
+
+    auto expect = [&](isize len) { if (size < len) throw VAError(ERROR_OPT_INVARG); };
+
+    switch (cmd) {
+
+        case ControlCmd::Quit:
+
+            break;
+
+        case ControlCmd::Run:
+
+            expect(4);
+            amiga.executeFrames(isize(R32BE(args)));
+            append64(response, u64(amiga.agnus.frame.nr));
+            break;
+
+        case ControlCmd::Input:
+
+            /* Each record is translated into an entry of the command queue.
+             * The meaning of the arguments depends on the command type:
+             *
+             *   CMD_CONFIG:            a = option, b = value, c = component id
+             *   CMD_KEY_xxx:           a = keycode
+             *   CMD_MOUSE_MOVE_xxx:    a = port, b = x, c = y
+             *   CMD_MOUSE_EVENT:       a = port, b = game pad action
+             *   CMD_JOY_EVENT:         a = port, b = game pad action
+             *   CMD_DSK_EJECT:         a = drive, b = delay
+             */
+            if (size % 16) throw VAError(ERROR_OPT_INVARG);
+
+            for (isize i = 0; i < size; i += 16) {
+
+                auto type = CmdType(R32BE(args + i));
+                auto a = i32(R32BE(args + i + 4));
+                auto b = i32(R32BE(args + i + 8));
+                auto c = i32(R32BE(args + i + 12));
+
+                Cmd input = { .type = type };
+
+                switch (type) {
+
+                    case CMD_CONFIG:
+
+                        input.config = { Option(a), i64(b), isize(c) };
+                        break;
+
+                    case CMD_KEY_PRESS:
+                    case CMD_KEY_RELEASE:
+                    case CMD_KEY_RELEASE_ALL:
+
+                        input.key = { KeyCode(a) };
+                        break;
+
+                    case CMD_MOUSE_MOVE_ABS:
+                    case CMD_MOUSE_MOVE_REL:
+
+                        input.port = { a, double(b), double(c), GamePadAction(0) };
+                        break;
+
+                    case CMD_MOUSE_EVENT:
+                    case CMD_JOY_EVENT:
+
+                        input.port = { a, 0.0, 0.0, GamePadAction(b) };
+                        break;
+
+                    case CMD_DSK_EJECT:
+
+                        if (a < 0 || a > 3) throw VAError(ERROR_OPT_INVARG);
+                        input.disk = { a, Cycle(b), nullptr };
+                        break;
+
+                    default:
+                        throw VAError(ERROR_OPT_UNSUPPORTED);
+                }
+
+                amiga.put(input);
+            }
+            break;
+
+        case ControlCmd::Peek:
+        {
+            expect(8);
+            auto addr = R32BE(args);
+            auto len = isize(R32BE(args + 4));
+
+            // The CPU address space is 16 MB in size
+            if (len > 0x1000000) throw VAError(ERROR_OPT_INVARG);
+
+            response.resize(8 + len);
+            amiga.mem.spypeek <ACCESSOR_CPU> (addr, len, response.data() + 8);
+            break;
+        }
+        case ControlCmd::Poke:
+        {
+            expect(4);
+            auto addr = R32BE(args);
+
+            if (!amiga.mem.isPatchable(addr, size - 4)) throw VAError(ERROR_OPT_INVARG);
+            amiga.mem.patch(addr, args + 4, size - 4);
+            break;
+        }
+        case ControlCmd::Save:
+        {
+            Snapshot snapshot(amiga);
+
+            response.insert(response.end(),
+                            snapshot.data.ptr, snapshot.data.ptr + snapshot.data.size);
+            break;
+        }
+        case ControlCmd::Restore:
+        {
+            Snapshot snapshot(args, size);
+
+            if (amiga.isPoweredOff()) {
+
+                // Powering on requires the emulator thread
+                if (forked) throw VAError(ERROR_POWERED_OFF);
+                amiga.powerOn();
+            }
+            amiga.loadSnapshot(snapshot);
+            break;
+        }
+        case ControlCmd::Hash:
+        {
+            auto &buffer = amiga.denise.pixelEngine.getStableBuffer();
+
+            append64(response, util::fnv64((u8 *)buffer.ptr, buffer.size * sizeof(u32)));
+            break;
+        }
+        default:
+            throw VAError(ERROR_OPT_UNSUPPORTED);
+    }
+}
+
+static string
+executablePath(const char *argv0)
+{
+    // Ask the OS first, because argv[0] may be a name looked up in $PATH
+#if defined(__APPLE__)
+
+    char path[PATH_MAX];
+    uint32_t size = sizeof(path);
+    if (_NSGetExecutablePath(path, &size) == 0) return util::makeAbsolutePath(path);
+
+#elif defined(__linux__)
+
+    std::error_code ec;
+    auto path = fs::read_symlink("/proc/self/exe", ec);
+    if (!ec) return path.string();
+
+#endif
+
+    // If argv[0] contains no slash, posix_spawnp will search $PATH
+    auto path0 = string(argv0);
+    return path0.find('/') == string::npos ? path0 : util::makeAbsolutePath(path0);
 }
 
 void
@@ -87,8 +559,13 @@ Headless::parseArguments(int argc, char *argv[])
 {
     static struct option long_options[] = {
         
-        { "verbose",    no_argument,    NULL,   'v' },
-        { "messages",   no_argument,    NULL,   'm' },
+        { "verbose",    no_argument,        NULL,   'v' },
+        { "messages",   no_argument,        NULL,   'm' },
+        { "jobs",       required_argument,  NULL,   'j' },
+        { "control",    no_argument,        NULL,   'c' },
+        { "socket",     required_argument,  NULL,   's' },
+        { "fork",       no_argument,        NULL,   'f' },
+        { "restore",    required_argument,  NULL,   'r' },
         { NULL,         0,              NULL,    0  }
     };
     
@@ -96,12 +573,12 @@ Headless::parseArguments(int argc, char *argv[])
     opterr = 0;
     
     // Remember the execution path
-    keys["exec"] = util::makeAbsolutePath(argv[0]);
+    keys["exec"] = executablePath(argv[0]);
 
     // Parse all options
     while (1) {
         
-        int arg = getopt_long(argc, argv, ":vm", long_options, NULL);
+        int arg = getopt_long(argc, argv, ":vmj:cs:fr:", long_options, NULL);
         if (arg == -1) break;
 
         switch (arg) {
@@ -114,6 +591,26 @@ Headless::parseArguments(int argc, char *argv[])
                 keys["messages"] = "1";
                 break;
 
+            case 'j':
+                keys["jobs"] = optarg;
+                break;
+
+            case 'c':
+                keys["control"] = "1";
+                break;
+
+            case 's':
+                keys["socket"] = optarg;
+                break;
+
+            case 'f':
+                keys["fork"] = "1";
+                break;
+
+            case 'r':
+                keys["restore"] = util::makeAbsolutePath(optarg);
+                break;
+
             case ':':
                 throw SyntaxError("Missing argument for option '" +
                                   string(argv[optind - 1]) + "'");
@@ -136,17 +633,52 @@ Headless::parseArguments(int argc, char *argv[])
 void
 Headless::checkArguments()
 {
-    // The user needs to specify a single input file
-    if (keys.find("arg1") == keys.end()) {
+    auto control = keys.find("control") != keys.end() || keys.find("socket") != keys.end();
+
+    // The user needs to specify at least one input file
+    if (keys.find("arg1") == keys.end() && !control) {
         throw SyntaxError("No script file is given");
     }
-    if (keys.find("arg2") != keys.end()) {
-        throw SyntaxError("More than one script file is given");
+
+    // In control mode, a single setup script can be given
+    if (keys.find("arg2") != keys.end() && control) {
+        throw SyntaxError("Only one script can be given in control mode");
+    }
+
+    // The socket path must fit into a socket address
+    if (keys.find("socket") != keys.end()) {
+
+        if (keys["socket"].size() >= sizeof(sockaddr_un::sun_path)) {
+            throw SyntaxError("Socket path is too long");
+        }
+    }
+
+    // Fork mode and snapshots are only available in control mode
+    if (keys.find("fork") != keys.end() && keys.find("socket") == keys.end()) {
+        throw SyntaxError("Fork mode requires a socket");
+    }
+    if (keys.find("restore") != keys.end()) {
+
+        if (!control) throw SyntaxError("Snapshots can only be restored in control mode");
+        if (!util::fileExists(keys["restore"])) {
+            throw SyntaxError("File " + keys["restore"] + " does not exist");
+        }
     }
         
-    // The input file must exist
-    if (!util::fileExists(keys["arg1"])) {
-        throw SyntaxError("File " + keys["arg1"] + " does not exist");
+    // All input files must exist
+    for (isize nr = 1; keys.find("arg" + std::to_string(nr)) != keys.end(); nr++) {
+
+        auto &path = keys["arg" + std::to_string(nr)];
+        if (!util::fileExists(path)) {
+            throw SyntaxError("File " + path + " does not exist");
+        }
+    }
+
+    // The number of jobs must be a positive number
+    if (keys.find("jobs") != keys.end()) {
+
+        try { if (std::stol(keys["jobs"]) < 1) throw std::exception(); }
+        catch (std::exception &) { throw SyntaxError("Invalid number of jobs"); }
     }
 }
 
@@ -169,10 +701,20 @@ Headless::process(long type, u32 data1, u32 data2)
         
     switch (type) {
             
-        case MSG_SCRIPT_DONE:
         case MSG_SCRIPT_ABORT:
+
+            returnCode = 1;
+            halt = true;
+            barrier.unlock();
+            break;
+
         case MSG_ABORT:
 
+            returnCode = int(data1);
+            [[fallthrough]];
+
+        case MSG_SCRIPT_DONE:
+
             halt = true;
             [[fallthrough]];
             
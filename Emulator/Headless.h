@@ -19,6 +19,37 @@ struct SyntaxError : public std::runtime_error {
     using runtime_error::runtime_error;
 };
 
+/* Commands of the binary control protocol
+ *
+ * Each request consists of an 8 byte header followed by the payload. The
+ * header contains the command and the size of the payload. Each response
+ * consists of an 8 byte header containing an error code (ERROR_OK on success)
+ * and the payload size, followed by the payload. All integers are transmitted
+ * in big-endian byte order.
+ *
+ *   Command   Request payload                     Response payload
+ *   ----------------------------------------------------------------------
+ *   Quit      -                                   -
+ *   Run       u32 frames                          u64 frame number
+ *   Input     { u32 type, i32 a, i32 b, i32 c }*  -
+ *   Peek      u32 addr, u32 len                   u8 data[len]
+ *   Poke      u32 addr, u8 data[]                 -
+ *   Save      -                                   Snapshot
+ *   Restore   Snapshot                            -
+ *   Hash      -                                   u64 texture checksum
+ */
+enum class ControlCmd : u32
+{
+    Quit,
+    Run,
+    Input,
+    Peek,
+    Poke,
+    Save,
+    Restore,
+    Hash
+};
+
 void process(const void *listener, long type, u32 data1, u32 data2);
 
 class Headless {
@@ -35,6 +66,12 @@ class Headless {
     // Exit flag
     bool halt = false;
 
+    // Exit code reported by the emulator
+    int returnCode = 0;
+
+    // Indicates a forked process (which lacks the emulator thread)
+    bool forked = false;
+
     
     //
     // Launching
@@ -43,7 +80,7 @@ class Headless {
 public:
 
     // Main entry point
-    void main(int argc, char *argv[]);
+    int main(int argc, char *argv[]);
 
 private:
 
@@ -58,6 +95,24 @@ private:
     // Running
     //
 
+private:
+
+    // Executes a single script
+    int runScript(const string &path);
+
+    // Executes multiple scripts in parallel worker processes
+    int runBatch();
+
+    // Executes commands received via the binary control protocol
+    int runControl();
+
+    // Serves a single control connection (returns true if Quit was received)
+    bool serveControl(int in, int out);
+
+    // Executes a single control command
+    void execControl(ControlCmd cmd, vector<u8> &request, vector<u8> &response) throws;
+
+    
 public:
     
     // Processes an incoming message
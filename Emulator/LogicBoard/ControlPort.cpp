@@ -45,6 +45,8 @@ ControlPort::_inspect() const
         info.potgo = paula.potgo;
         info.potgor = paula.peekPOTGOR();
         info.potdat = (nr == PORT_1) ? paula.peekPOTxDAT<0>() : paula.peekPOTxDAT<1>();
+
+        publishedInfo.write(info);
     }
 }
 
@@ -21,6 +21,7 @@ class ControlPort : public SubComponent {
 
     // The result of the latest inspection
     mutable ControlPortInfo info = {};
+    mutable util::Seqlock<ControlPortInfo> publishedInfo;
     
     // The connected device
     ControlPortDevice device = CPD_NONE;
@@ -85,6 +86,15 @@ private:
     template <class T>
     void applyToResetItems(T& worker, bool hard = true)
     {
+        if (hard) {
+
+            worker
+
+            << device
+            << mouseX
+            << mouseY;
+        }
+
         worker
 
         << mouseCounterX
@@ -105,7 +115,7 @@ private:
 
 public:
     
-    ControlPortInfo getInfo() const { return AmigaComponent::getInfo(info); }    
+    ControlPortInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }    
 
     bool isPort1() const { return nr == PORT_1; }
     bool isPort2() const { return nr == PORT_2; }
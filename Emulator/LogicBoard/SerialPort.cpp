@@ -80,6 +80,8 @@ SerialPort::_inspect() const
         info.dsr = getDSR();
         info.cd = getCD();
         info.dtr = getDTR();
+
+        publishedInfo.write(info);
     }
 }
 
@@ -28,6 +28,7 @@ class SerialPort : public SubComponent {
 
     // Result of the latest inspection
     mutable SerialPortInfo info = {};
+    mutable util::Seqlock<SerialPortInfo> publishedInfo;
 
     // The current values of the port pins
     u32 port = 0;
@@ -104,7 +105,7 @@ public:
     
 public:
 
-    SerialPortInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    SerialPortInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
  
 
     //
@@ -12,6 +12,7 @@
 #include "Amiga.h"
 #include "BootBlockImage.h"
 #include "Checksum.h"
+#include "Concurrency.h"
 #include "FloppyDisk.h"
 #include "FloppyDrive.h"
 #include "IOUtils.h"
@@ -278,7 +279,7 @@ ADFFile::encodeDisk(FloppyDisk &disk) const
     disk.clearDisk();
 
     // Encode all tracks
-    for (Track t = 0; t < tracks; t++) encodeTrack(disk, t);
+    util::parallelFor(tracks, [&](Track t) { encodeTrack(disk, t); });
 
     // In debug mode, also run the decoder
     if constexpr (ADF_DEBUG) {
@@ -379,9 +380,7 @@ ADFFile::encodeSector(FloppyDisk &disk, Track t, Sector s) const
     FloppyDisk::encodeOddEven(&p[56], dcheck, sizeof(bcheck));
     
     // Add clock bits
-    for(isize i = 8; i < 1088; i++) {
-        p[i] = FloppyDisk::addClockBits(p[i], p[i-1]);
-    }    
+    FloppyDisk::addClockBits(&p[8], 1080);
 }
 
 void
@@ -408,7 +407,7 @@ ADFFile::decodeDisk(FloppyDisk &disk)
     disk.repeatTracks();
 
     // Decode all tracks
-    for (Track t = 0; t < tracks; t++) decodeTrack(disk, t);
+    util::parallelFor(tracks, [&](Track t) { decodeTrack(disk, t); });
 }
 
 void
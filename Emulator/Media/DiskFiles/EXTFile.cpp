@@ -179,18 +179,13 @@ EXTFile::encodeDisk(class FloppyDisk &disk) const
 void
 EXTFile::encodeTrack(class FloppyDisk &disk, Track t) const
 {
-    auto numTracks = storedTracks();
-    
-    for (isize i = 0; i < numTracks; i++) {
+    debug(MFM_DEBUG, "Encoding track %ld\n", t);
 
-        debug(MFM_DEBUG, "Encoding track %ld\n", i);
-        
-        auto numBits = usedBitsForTrack(i);
-        assert(numBits % 8 == 0);
-        
-        std::memcpy(disk.data.track[i], trackData(i), numBits / 8);
-        disk.length.track[i] = (i32)(numBits / 8);
-    }
+    auto numBits = usedBitsForTrack(t);
+    assert(numBits % 8 == 0);
+
+    std::memcpy(disk.data.track[t], trackData(t), numBits / 8);
+    disk.length.track[t] = (i32)(numBits / 8);
 }
 
 void
@@ -246,10 +241,9 @@ EXTFile::decodeDisk(FloppyDisk &disk)
     for (Track t = 0; t < numTracks; t++) {
         
         auto bytes = disk.length.track[t];
-        
-        for (isize i = 0; i < bytes; i++, p++) {
-            *p = disk.data.track[t][i];
-        }
+
+        std::memcpy(p, disk.data.track[t], bytes);
+        p += bytes;
     }
     
     debug(ADF_DEBUG, "Wrote %td bytes\n", p - data.ptr);
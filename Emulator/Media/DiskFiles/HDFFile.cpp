@@ -68,8 +68,17 @@ HDFFile::init(const u8 *buf, isize len)
 void
 HDFFile::init(const HardDrive &drive)
 {
-    {   MEASURE_TIME("AmigaFile::readFromBuffer(drive.data)")
-        
+    if (drive.volume) {
+
+        // Compose the image from the mirrored directory
+        data.alloc(drive.geometry.numBytes());
+        drive.volume->exportBlocks(data.ptr);
+        finalizeRead();
+
+    } else {
+
+        MEASURE_TIME("AmigaFile::readFromBuffer(drive.data)")
+
         AmigaFile::readFromBuffer(drive.data);
     }
     
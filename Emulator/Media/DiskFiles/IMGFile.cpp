@@ -10,6 +10,7 @@
 #include "config.h"
 #include "IMGFile.h"
 #include "Checksum.h"
+#include "Concurrency.h"
 #include "FloppyDisk.h"
 #include "IOUtils.h"
 
@@ -82,7 +83,7 @@ IMGFile::encodeDisk(FloppyDisk &disk) const
     debug(IMG_DEBUG, "Encoding DOS disk with %ld tracks\n", tracks);
 
     // Encode all tracks
-    for (Track t = 0; t < tracks; t++) encodeTrack(disk, t);
+    util::parallelFor(tracks, [&](Track t) { encodeTrack(disk, t); });
 
     // In debug mode, also run the decoder
     if constexpr (IMG_DEBUG) {
@@ -209,7 +210,7 @@ IMGFile::decodeDisk(FloppyDisk &disk)
     disk.repeatTracks();
 
     // Decode all tracks
-    for (Track t = 0; t < tracks; t++) decodeTrack(disk, t);
+    util::parallelFor(tracks, [&](Track t) { decodeTrack(disk, t); });
 }
 
 void
@@ -376,6 +376,9 @@ Memory::didLoadFromBuffer(const u8 *buffer)
     reader.copy(slow, slowSize);
     reader.copy(fast, fastSize);
 
+    // Rebuild the page pointer tables (the memory may have been reallocated)
+    updateCpuPageTables();
+
     return (isize)(reader.ptr - buffer);
 }
 
@@ -898,10 +901,69 @@ Memory::updateCpuMemSrcTable()
 
     // Expansion boards
     zorro.updateMemSrcTables();
+
+    // Page pointers
+    updateCpuPageTables();
     
     msgQueue.put(MSG_MEM_LAYOUT);
 }
 
+void
+Memory::updateCpuPageTables()
+{
+    auto bank = [&](u8 *base, u32 mask, isize i) {
+        return mask >= 0xFFFF ? base + ((i << 16) & mask) : nullptr;
+    };
+    
+    for (isize i = 0; i <= 0xFF; i++) {
+
+        u8 *r = nullptr, *w = nullptr;
+        isize *rc = nullptr, *wc = nullptr;
+
+        switch (cpuMemSrc[i]) {
+
+            case MEM_FAST:
+            {
+                isize offset = (i << 16) - FAST_RAM_STRT;
+                
+                if (offset >= 0 && offset + 0x10000 <= config.fastSize) {
+                    
+                    r = w = fast + offset;
+                    rc = &stats.fastReads.raw;
+                    wc = &stats.fastWrites.raw;
+                }
+                break;
+            }
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+
+                r = bank(rom, romMask, i);
+                rc = &stats.kickReads.raw;
+                break;
+
+            case MEM_WOM:
+
+                r = bank(wom, womMask, i);
+                rc = &stats.kickReads.raw;
+                break;
+
+            case MEM_EXT:
+
+                r = bank(ext, extMask, i);
+                rc = &stats.kickReads.raw;
+                break;
+
+            default:
+                break;
+        }
+
+        cpuReadPage[i] = r;
+        cpuWritePage[i] = w;
+        cpuReadCounter[i] = rc;
+        cpuWriteCounter[i] = wc;
+    }
+}
+
 void
 Memory::updateAgnusMemSrcTable()
 {
@@ -1010,12 +1072,14 @@ Memory::spypeek32(u32 addr) const
 template<> u8
 Memory::peek8 <ACCESSOR_CPU, MEM_NONE> (u32 addr)
 {
+    copper.catchUp();
     return (u8)(spypeek16 <ACCESSOR_CPU, MEM_NONE> (addr));
 }
 
 template<> u16
 Memory::peek16 <ACCESSOR_CPU, MEM_NONE> (u32 addr)
 {
+    copper.catchUp();
     return spypeek16 <ACCESSOR_CPU, MEM_NONE> (addr);
 }
 
@@ -1025,7 +1089,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.chipReads.raw++;
+    if constexpr (MEM_STATS) stats.chipReads.raw++;
     dataBus = READ_CHIP_8(addr);
     return (u8)dataBus;
 }
@@ -1036,7 +1100,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.chipReads.raw++;
+    if constexpr (MEM_STATS) stats.chipReads.raw++;
     dataBus = READ_CHIP_16(addr);
     return dataBus;
 }
@@ -1053,7 +1117,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
+    if constexpr (MEM_STATS) stats.slowReads.raw++;
     dataBus = READ_SLOW_8(addr);
     return (u8)dataBus;
 }
@@ -1064,7 +1128,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
+    if constexpr (MEM_STATS) stats.slowReads.raw++;
     dataBus = READ_SLOW_16(addr);
     return dataBus;
 }
@@ -1080,7 +1144,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
+    if constexpr (MEM_STATS) stats.fastReads.raw++;
     return READ_FAST_8(addr);
 }
 
@@ -1089,7 +1153,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
+    if constexpr (MEM_STATS) stats.fastReads.raw++;
     return READ_FAST_16(addr);
 }
 
@@ -1163,6 +1227,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_CUSTOM> (u32 addr)
     ASSERT_CUSTOM_ADDR(addr);
             
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
 
     if (IS_EVEN(addr)) {
         dataBus = HI_BYTE(peekCustom16(addr));
@@ -1178,6 +1243,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_CUSTOM> (u32 addr)
     ASSERT_CUSTOM_ADDR(addr);
     
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
     
     dataBus = peekCustom16(addr);
     return dataBus;
@@ -1252,7 +1318,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_ROM_8(addr);
 }
 
@@ -1261,7 +1327,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_ROM_16(addr);
 }
 
@@ -1276,7 +1342,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_WOM_8(addr);
 }
 
@@ -1285,7 +1351,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_WOM_16(addr);
 }
 
@@ -1300,7 +1366,7 @@ Memory::peek8 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_EXT_8(addr);
 }
 
@@ -1309,7 +1375,7 @@ Memory::peek16 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
+    if constexpr (MEM_STATS) stats.kickReads.raw++;
     return READ_EXT_16(addr);
 }
 
@@ -1319,8 +1385,8 @@ Memory::spypeek16 <ACCESSOR_CPU, MEM_EXT> (u32 addr) const
     return READ_EXT_16(addr);
 }
 
-template<> u8
-Memory::peek8 <ACCESSOR_CPU> (u32 addr)
+u8
+Memory::slowPeek8(u32 addr)
 {
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
@@ -1347,8 +1413,8 @@ Memory::peek8 <ACCESSOR_CPU> (u32 addr)
     }
 }
 
-template<> u16
-Memory::peek16 <ACCESSOR_CPU> (u32 addr)
+u16
+Memory::slowPeek16(u32 addr)
 {
     assert(IS_EVEN(addr));
     
@@ -1428,8 +1494,44 @@ Memory::spypeek <ACCESSOR_CPU> (u32 addr, isize len, u8 *buf) const
 {
     assert(buf);
     
-    for (isize i = 0; i < len; i++) {
-        buf[i] = spypeek8 <ACCESSOR_CPU> (u32(addr + i));
+    while (len > 0) {
+
+        // Process the range bank by bank
+        auto bank = (addr & 0xFFFFFF) >> 16;
+        auto offset = addr & 0xFFFF;
+        auto count = std::min(len, isize(0x10000 - offset));
+
+        // Copy plain memory in one go and dispatch everything else
+        if (auto page = spyPage(bank)) {
+            std::memcpy(buf, page + offset, count);
+        } else {
+            for (isize i = 0; i < count; i++) {
+                buf[i] = spypeek8 <ACCESSOR_CPU> (u32(addr + i));
+            }
+        }
+
+        addr += u32(count);
+        buf += count;
+        len -= count;
+    }
+}
+
+const u8 *
+Memory::spyPage(isize bank) const
+{
+    auto page = [&](const u8 *base, u32 mask) -> const u8 * {
+        return mask >= 0xFFFF ? base + ((bank << 16) & mask) : nullptr;
+    };
+
+    switch (cpuMemSrc[bank]) {
+
+        case MEM_CHIP:
+        case MEM_CHIP_MIRROR:   return page(chip, chipMask);
+        case MEM_SLOW:
+        case MEM_SLOW_MIRROR:   return page(slow, slowMask);
+
+        default:
+            return cpuReadPage[bank];
     }
 }
 
@@ -1550,8 +1652,9 @@ Memory::poke8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u8 value)
     }
 
     agnus.executeUntilBusIsFree();
+    copper.cancelRun(addr);
     
-    stats.chipWrites.raw++;
+    if constexpr (MEM_STATS) stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_8(addr, value);
 }
@@ -1568,8 +1671,9 @@ Memory::poke16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u16 value)
     }
 
     agnus.executeUntilBusIsFree();
+    copper.cancelRun(addr);
     
-    stats.chipWrites.raw++;
+    if constexpr (MEM_STATS) stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_16(addr, value);
 }
@@ -1580,8 +1684,9 @@ Memory::poke8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u8 value)
     ASSERT_SLOW_ADDR(addr);
     
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
     
-    stats.slowWrites.raw++;
+    if constexpr (MEM_STATS) stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_8(addr, value);
 }
@@ -1592,8 +1697,9 @@ Memory::poke16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u16 value)
     ASSERT_SLOW_ADDR(addr);
     
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
     
-    stats.slowWrites.raw++;
+    if constexpr (MEM_STATS) stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_16(addr, value);
 }
@@ -1603,7 +1709,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u8 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
+    if constexpr (MEM_STATS) stats.fastWrites.raw++;
     WRITE_FAST_8(addr, value);
 }
 
@@ -1612,7 +1718,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u16 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
+    if constexpr (MEM_STATS) stats.fastWrites.raw++;
     WRITE_FAST_16(addr, value);
 }
 
@@ -1667,6 +1773,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_CUSTOM> (u32 addr, u8 value)
     ASSERT_CUSTOM_ADDR(addr);
     
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
     
     dataBus = value;
     // http://eab.abime.net/showthread.php?p=1156399
@@ -1679,6 +1786,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_CUSTOM> (u32 addr, u16 value)
     ASSERT_CUSTOM_ADDR(addr);
 
     agnus.executeUntilBusIsFree();
+    copper.cancelRun();
 
     dataBus = value;
     pokeCustom16<ACCESSOR_CPU>(addr, value);
@@ -1722,7 +1830,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_ROM> (u32 addr, u8 value)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickWrites.raw++;
+    if constexpr (MEM_STATS) stats.kickWrites.raw++;
     
     // On Amigas with a WOM, writing into ROM space locks the WOM
     if (hasWom() && !womIsLocked) {
@@ -1743,7 +1851,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u8 value)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickWrites.raw++;
+    if constexpr (MEM_STATS) stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_8(addr, value);
 }
 
@@ -1752,7 +1860,7 @@ Memory::poke16 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u16 value)
 {
     ASSERT_WOM_ADDR(addr);
 
-    stats.kickWrites.raw++;
+    if constexpr (MEM_STATS) stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_16(addr, value);
 }
 
@@ -1760,18 +1868,18 @@ template <> void
 Memory::poke8 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u8 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
+    if constexpr (MEM_STATS) stats.kickWrites.raw++;
 }
 
 template <> void
 Memory::poke16 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u16 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
+    if constexpr (MEM_STATS) stats.kickWrites.raw++;
 }
 
-template<> void
-Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
+void
+Memory::slowPoke8(u32 addr, u8 value)
 {
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
@@ -1798,8 +1906,8 @@ Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
     }
 }
 
-template<> void
-Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
+void
+Memory::slowPoke16(u32 addr, u16 value)
 {
     assert(IS_EVEN(addr));
     
@@ -1876,6 +1984,40 @@ Memory::poke16 <ACCESSOR_AGNUS> (u32 addr, u16 value)
     }
 }
 
+template<> void
+Memory::poke <ACCESSOR_AGNUS> (u32 addr, isize len, const u8 *buf)
+{
+    assert(buf);
+    assert(IS_EVEN(addr) && IS_EVEN(len));
+
+    if (len == 0) return;
+
+    while (len > 0) {
+
+        // Process the range bank by bank
+        addr &= agnus.ptrMask;
+        auto bank = addr >> 16;
+        auto count = std::min(len, isize(0x10000 - (addr & 0xFFFF)));
+
+        switch (agnusMemSrc[bank]) {
+
+            case MEM_NONE:          break;
+            case MEM_CHIP:          std::memcpy(chip + (addr & chipMask), buf, count); break;
+            case MEM_SLOW_MIRROR:   std::memcpy(slow + (addr & slowMask), buf, count); break;
+
+            default:
+                fatalError;
+        }
+
+        addr += u32(count);
+        buf += count;
+        len -= count;
+    }
+
+    // Leave the last written value on the data bus
+    dataBus = R16BE(buf - 2);
+}
+
 u8
 Memory::peekCIA8(u32 addr)
 {
@@ -2725,6 +2867,27 @@ Memory::patch(u32 addr, u8 *buf, isize len)
     }
 }
 
+bool
+Memory::isPatchable(u32 addr, isize len) const
+{
+    for (isize i = 0; i < len; i++) {
+
+        switch (cpuMemSrc[((addr + i) & 0xFFFFFF) >> 16]) {
+
+            case MEM_CHIP: case MEM_CHIP_MIRROR:
+            case MEM_SLOW: case MEM_SLOW_MIRROR:
+            case MEM_FAST:
+            case MEM_ROM: case MEM_ROM_MIRROR:
+            case MEM_WOM: case MEM_EXT:
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
 const char *
 Memory::regName(u32 addr)
 {
@@ -187,6 +187,18 @@ public:
     MemorySource cpuMemSrc[256];
     MemorySource agnusMemSrc[256];
 
+    /* To speed up CPU accesses, each bank which maps to plain memory without
+     * any side effects is assigned a host pointer to the beginning of the
+     * bank. A null pointer indicates that the access must be dispatched via
+     * cpuMemSrc. Each non-null entry comes with a pointer to the statistical
+     * counter the access is recorded in.
+     * See also: updateCpuPageTables()
+     */
+    u8 *cpuReadPage[256];
+    u8 *cpuWritePage[256];
+    isize *cpuReadCounter[256];
+    isize *cpuWriteCounter[256];
+
     // The last value on the data bus
     u16 dataBus;
 
@@ -417,6 +429,9 @@ private:
     void updateCpuMemSrcTable();
     void updateAgnusMemSrcTable();
 
+    // Derives the page pointer tables from the CPU memory source table
+    void updateCpuPageTables();
+
     
     //
     // Accessing memory
@@ -440,6 +455,20 @@ public:
     template <Accessor acc, MemorySource src> void poke16(u32 addr, u16 value);
     template <Accessor acc> void poke8(u32 addr, u8 value);
     template <Accessor acc> void poke16(u32 addr, u16 value);
+    template <Accessor acc> void poke(u32 addr, isize len, const u8 *buf);
+
+private:
+
+    // Dispatches a CPU access via the memory source table
+    u8 slowPeek8(u32 addr);
+    u16 slowPeek16(u32 addr);
+    void slowPoke8(u32 addr, u8 value);
+    void slowPoke16(u32 addr, u16 value);
+
+    // Returns a pointer to a bank that can be read without side effects
+    const u8 *spyPage(isize bank) const;
+
+public:
     
 
     //
@@ -490,6 +519,9 @@ public:
     void patch(u32 addr, u32 value);
     void patch(u32 addr, u8 *buf, isize len);
 
+    // Checks whether all bytes of a memory range are backed by Ram or Rom
+    bool isPatchable(u32 addr, isize len) const;
+
     
     //
     // Debugging
@@ -510,3 +542,70 @@ public:
     std::vector <u32> search(u64 pattern, isize bytes);
     std::vector <u32> search(auto pattern) { return search(pattern, isizeof(pattern)); }
 };
+
+
+//
+// Accessing memory (CPU)
+//
+
+/* CPU accesses to plain memory are served directly via the page pointer
+ * tables. All other accesses are dispatched via the memory source table.
+ */
+
+template<> inline u8
+Memory::peek8 <ACCESSOR_CPU> (u32 addr)
+{
+    isize bank = (addr & 0xFFFFFF) >> 16;
+
+    if (u8 *page = cpuReadPage[bank]) {
+
+        if constexpr (MEM_STATS) (*cpuReadCounter[bank])++;
+        return R8BE_ALIGNED(page + (addr & 0xFFFF));
+    }
+    return slowPeek8(addr);
+}
+
+template<> inline u16
+Memory::peek16 <ACCESSOR_CPU> (u32 addr)
+{
+    assert(IS_EVEN(addr));
+
+    isize bank = (addr & 0xFFFFFF) >> 16;
+
+    if (u8 *page = cpuReadPage[bank]) {
+
+        if constexpr (MEM_STATS) (*cpuReadCounter[bank])++;
+        return R16BE_ALIGNED(page + (addr & 0xFFFF));
+    }
+    return slowPeek16(addr);
+}
+
+template<> inline void
+Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
+{
+    isize bank = (addr & 0xFFFFFF) >> 16;
+
+    if (u8 *page = cpuWritePage[bank]) {
+
+        if constexpr (MEM_STATS) (*cpuWriteCounter[bank])++;
+        W8BE_ALIGNED(page + (addr & 0xFFFF), value);
+        return;
+    }
+    slowPoke8(addr, value);
+}
+
+template<> inline void
+Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
+{
+    assert(IS_EVEN(addr));
+
+    isize bank = (addr & 0xFFFFFF) >> 16;
+
+    if (u8 *page = cpuWritePage[bank]) {
+
+        if constexpr (MEM_STATS) (*cpuWriteCounter[bank])++;
+        W16BE_ALIGNED(page + (addr & 0xFFFF), value);
+        return;
+    }
+    slowPoke16(addr, value);
+}
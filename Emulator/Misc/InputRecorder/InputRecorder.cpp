@@ -0,0 +1,482 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "InputRecorder.h"
+#include "Amiga.h"
+#include "Checksum.h"
+
+#include <fstream>
+
+void
+InputRecorder::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::State) {
+
+        os << tab("State");
+        os << (state == State::record ? "Recording" :
+               state == State::play ? "Playing" : "Idle") << std::endl;
+        os << tab("File");
+        os << path.string() << std::endl;
+        os << tab("Records");
+        os << dec(records) << std::endl;
+        os << tab("Size");
+        os << dec(isize(data.size())) << " Bytes" << std::endl;
+        os << tab("Frame mismatches");
+        os << dec(mismatches) << std::endl;
+    }
+}
+
+void
+InputRecorder::_reset(bool hard)
+{
+    if (hard) {
+
+        // A hard reset invalidates the time base of the recording
+        if (state != State::idle) {
+
+            try { stop(); } catch (VAError &error) {
+                warn("%s: %s\n", path.string().c_str(), error.what());
+            }
+        }
+
+    } else if (state == State::play) {
+
+        // A soft reset has wiped out all pending events
+        agnus.scheduleAbs<SLOT_INP>(next, INP_REPLAY);
+    }
+}
+
+void
+InputRecorder::_didLoad()
+{
+    // Loading a snapshot invalidates the time base of the recording
+    if (state != State::idle) {
+
+        try { stop(); } catch (VAError &error) {
+            warn("%s: %s\n", path.string().c_str(), error.what());
+        }
+    }
+}
+
+void
+InputRecorder::startRecording(const fs::path &path)
+{
+    if (!isPoweredOn()) throw VAError(ERROR_POWERED_OFF);
+
+    // Make sure the recording can be saved later
+    if (!std::ofstream(path, std::ios::binary).is_open()) {
+        throw VAError(ERROR_FILE_CANT_CREATE, path.string());
+    }
+
+    {   SUSPENDED
+
+        if (state != State::idle) stop();
+
+        // Start from a well-defined state
+        amiga.hardReset();
+
+        data.assign(std::begin(signature), std::end(signature));
+        write8(version);
+        write64(amiga.checksum());
+
+        this->path = path;
+        last = agnus.clock;
+        records = 0;
+        mismatches = 0;
+        state = State::record;
+    }
+
+    msg("Recording inputs to %s\n", path.string().c_str());
+}
+
+void
+InputRecorder::startPlayback(const fs::path &path)
+{
+    if (!isPoweredOn()) throw VAError(ERROR_POWERED_OFF);
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_NOT_FOUND, path.string());
+
+    std::vector<u8> buffer((std::istreambuf_iterator<char>(stream)),
+                           std::istreambuf_iterator<char>());
+
+    // Check the file header
+    if (buffer.size() < sizeof(signature) + 9 ||
+        !std::equal(std::begin(signature), std::end(signature), buffer.begin()) ||
+        buffer[sizeof(signature)] != version) {
+        throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+    }
+
+    {   SUSPENDED
+
+        if (state != State::idle) stop();
+
+        // Start from the same state the recording has started from
+        amiga.hardReset();
+
+        data = std::move(buffer);
+        pos = sizeof(signature) + 1;
+
+        if (read64() != amiga.checksum()) {
+            warn("%s: Initial state differs from the recorded one\n",
+                 path.string().c_str());
+        }
+
+        this->path = path;
+        next = agnus.clock;
+        records = 0;
+        mismatches = 0;
+        frameCycle = -1;
+        state = State::play;
+
+        scheduleNext();
+    }
+
+    msg("Playing back inputs from %s\n", path.string().c_str());
+}
+
+void
+InputRecorder::stop()
+{
+    SUSPENDED
+
+    switch (state) {
+
+        case State::record:
+        {
+            state = State::idle;
+
+            std::ofstream stream(path, std::ios::binary);
+            if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_WRITE, path.string());
+            stream.write((const char *)data.data(), std::streamsize(data.size()));
+
+            msg("Recorded %ld inputs (%zu bytes)\n", records, data.size());
+            break;
+        }
+        case State::play:
+
+            state = State::idle;
+            agnus.cancel<SLOT_INP>();
+
+            msg("Played back %ld inputs (%ld frame mismatches)\n",
+                records, mismatches);
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool
+InputRecorder::filter(const Cmd &cmd)
+{
+    assert(state != State::idle);
+
+    // During playback, only the inputs injected by the player pass
+    if (state == State::play) {
+
+        if (!injecting) {
+            debug(INP_DEBUG, "Ignoring %s\n", CmdTypeEnum::key(cmd.type));
+        }
+        return injecting;
+    }
+
+    beginRecord(u8(cmd.type));
+
+    switch (cmd.type) {
+
+        case CMD_KEY_PRESS:
+        case CMD_KEY_RELEASE:
+
+            write8(u8(cmd.key.keycode));
+            break;
+
+        case CMD_MOUSE_MOVE_ABS:
+        case CMD_MOUSE_MOVE_REL:
+        {
+            u64 x, y;
+            std::memcpy(&x, &cmd.port.x, sizeof(x));
+            std::memcpy(&y, &cmd.port.y, sizeof(y));
+
+            write8(u8(cmd.port.port));
+            write64(x);
+            write64(y);
+            break;
+        }
+        case CMD_MOUSE_EVENT:
+        case CMD_JOY_EVENT:
+
+            write8(u8(cmd.port.port));
+            write8(u8(cmd.port.action));
+            break;
+
+        case CMD_DSK_INSERT:
+        {
+            auto &disk = *(FloppyDisk *)cmd.disk.disk;
+
+            write8(u8(cmd.disk.drive));
+            writeVarint(u64(cmd.disk.delay));
+
+            // Embed the disk in the same format a snapshot stores it
+            util::SerCounter counter;
+            counter << disk.getDiameter() << disk.getDensity();
+            disk.applyToPersistentItems(counter);
+            writeVarint(u64(counter.count));
+
+            auto offset = data.size();
+            data.resize(offset + usize(counter.count));
+
+            util::SerWriter writer(data.data() + offset);
+            writer << disk.getDiameter() << disk.getDensity();
+            disk.applyToPersistentItems(writer);
+            break;
+        }
+        case CMD_DSK_EJECT:
+
+            write8(u8(cmd.disk.drive));
+            writeVarint(u64(cmd.disk.delay));
+            break;
+
+        default:
+            fatalError;
+    }
+
+    return true;
+}
+
+bool
+InputRecorder::filterSerial(u16 value)
+{
+    assert(state != State::idle);
+
+    if (state == State::play) return injecting;
+
+    beginRecord(REC_SERIAL);
+    writeVarint(value);
+
+    return true;
+}
+
+void
+InputRecorder::processFrame()
+{
+    if (state == State::record) {
+
+        beginRecord(REC_FRAME);
+        write64(frameFingerprint());
+
+    } else {
+
+        // Remember the fingerprint until the corresponding record is due
+        frameCycle = agnus.clock;
+        frameHash = frameFingerprint();
+    }
+}
+
+u64
+InputRecorder::frameFingerprint() const
+{
+    auto words = (const u64 *)pixelEngine.getStableBuffer().ptr;
+    auto result = util::fnvInit64();
+
+    for (isize i = 0; i < HPIXELS * VPIXELS / 2; i++) {
+        result = util::fnvIt64(result, words[i]);
+    }
+
+    return result;
+}
+
+void
+InputRecorder::write64(u64 value)
+{
+    for (isize i = 56; i >= 0; i -= 8) write8(u8(value >> i));
+}
+
+void
+InputRecorder::writeVarint(u64 value)
+{
+    // Write seven bits at a time, starting with the least significant ones
+    for (; value >= 0x80; value >>= 7) write8(u8(value | 0x80));
+    write8(u8(value));
+}
+
+void
+InputRecorder::beginRecord(u8 type)
+{
+    assert(agnus.clock >= last);
+
+    writeVarint(u64(agnus.clock - last));
+    write8(type);
+
+    last = agnus.clock;
+    records++;
+}
+
+u8
+InputRecorder::read8()
+{
+    if (pos >= isize(data.size())) throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+    return data[pos++];
+}
+
+u64
+InputRecorder::read64()
+{
+    u64 result = 0;
+    for (isize i = 0; i < 8; i++) result = result << 8 | read8();
+    return result;
+}
+
+u64
+InputRecorder::readVarint()
+{
+    u64 result = 0;
+
+    for (isize shift = 0; shift < 64; shift += 7) {
+
+        auto byte = read8();
+        result |= u64(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return result;
+    }
+
+    throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+}
+
+void
+InputRecorder::scheduleNext()
+{
+    // Stop if all records have been processed
+    if (pos == isize(data.size())) { stop(); return; }
+
+    next += Cycle(readVarint());
+    agnus.scheduleAbs<SLOT_INP>(next, INP_REPLAY);
+}
+
+void
+InputRecorder::applyNext()
+{
+    auto type = read8();
+    records++;
+
+    Cmd cmd = { .type = CmdType(type) };
+
+    switch (type) {
+
+        case CMD_KEY_PRESS:
+        case CMD_KEY_RELEASE:
+
+            cmd.key = { .keycode = KeyCode(read8() & 0x7F) };
+            break;
+
+        case CMD_MOUSE_MOVE_ABS:
+        case CMD_MOUSE_MOVE_REL:
+        {
+            auto port = isize(read8());
+            auto x = read64();
+            auto y = read64();
+
+            cmd.port = { .port = port };
+            std::memcpy(&cmd.port.x, &x, sizeof(x));
+            std::memcpy(&cmd.port.y, &y, sizeof(y));
+            break;
+        }
+        case CMD_MOUSE_EVENT:
+        case CMD_JOY_EVENT:
+        {
+            auto port = isize(read8());
+            auto action = GamePadAction(read8());
+
+            if (!GamePadActionEnum::isValid(action)) {
+                throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+            }
+            cmd.port = { .port = port, .action = action };
+            break;
+        }
+        case CMD_DSK_INSERT:
+        {
+            auto drive = isize(read8() & 3);
+            auto delay = Cycle(readVarint());
+            auto size = isize(readVarint());
+
+            if (size > isize(data.size()) - pos) {
+                throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+            }
+
+            Diameter dia;
+            Density den;
+            util::SerReader reader(data.data() + pos);
+            reader << dia << den;
+            auto disk = std::make_unique<FloppyDisk>(reader, dia, den);
+            pos += size;
+
+            cmd.disk = { .drive = drive, .delay = delay, .disk = disk.release() };
+            break;
+        }
+        case CMD_DSK_EJECT:
+        {
+            auto drive = isize(read8() & 3);
+            auto delay = Cycle(readVarint());
+
+            cmd.disk = { .drive = drive, .delay = delay, .disk = nullptr };
+            break;
+        }
+        case REC_SERIAL:
+        {
+            auto value = u16(readVarint());
+
+            uart.receiveShiftReg = value;
+            uart.copyFromReceiveShiftRegister();
+            return;
+        }
+        case REC_FRAME:
+        {
+            auto hash = read64();
+
+            if (frameCycle != agnus.clock || frameHash != hash) {
+
+                if (!mismatches) {
+                    warn("Playback diverges in frame %lld\n", agnus.frame.nr);
+                }
+                mismatches++;
+            }
+            return;
+        }
+        default:
+            throw VAError(ERROR_FILE_TYPE_MISMATCH, path.string());
+    }
+
+    // Inject the input
+    injecting = true;
+    amiga.processCommand(cmd);
+    injecting = false;
+}
+
+void
+InputRecorder::serviceInputEvent()
+{
+    assert(agnus.id[SLOT_INP] == INP_REPLAY);
+
+    try {
+
+        // Apply all records that are due
+        while (state == State::play && next <= agnus.clock) {
+
+            applyNext();
+            scheduleNext();
+        }
+
+    } catch (VAError &error) {
+
+        warn("%s: %s\n", path.string().c_str(), error.what());
+        stop();
+    }
+}
@@ -0,0 +1,189 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "SubComponent.h"
+#include "CmdQueueTypes.h"
+#include "IOUtils.h"
+#include <vector>
+
+/* The input recorder records all external inputs (keyboard, mouse, joystick,
+ * disk changes, and serial data) together with the master clock cycle they
+ * have been applied at. The recording is stored in a compact binary file
+ * which can be played back later. During playback, the recorded inputs are
+ * re-injected at exactly the same cycles by an event in the INP slot and all
+ * live inputs are ignored.
+ *
+ * Both, recording and playback start with a hard reset. Hence, a recording
+ * reproduces the original session as long as it is played back with the same
+ * configuration, Roms, and initially inserted disks. To detect divergences,
+ * the recorder stores a fingerprint of each emulated frame which is checked
+ * during playback.
+ *
+ * File format:
+ *
+ *     Header: "VAINPUT" | version (1 byte) | checksum of the initial state
+ *     Record: cycle delta (varint) | type (1 byte) | payload
+ *
+ * The record type is either a command type (CMD_KEY_PRESS, CMD_JOY_EVENT,
+ * etc.) or one of the two types defined below. The payload depends on the
+ * record type.
+ */
+class InputRecorder : public SubComponent {
+
+    // File signature and format version
+    static constexpr u8 signature[7] = { 'V', 'A', 'I', 'N', 'P', 'U', 'T' };
+    static constexpr u8 version = 1;
+
+    // Record types which do not correspond to a command
+    static constexpr u8 REC_SERIAL = 0x40;
+    static constexpr u8 REC_FRAME = 0x41;
+
+    // The current recorder state
+    enum class State { idle, record, play };
+    State state = State::idle;
+
+    // Location of the recording
+    fs::path path;
+
+    // The recorded data (header and records)
+    std::vector<u8> data;
+
+    // Read position and cycle of the next record (playback only)
+    isize pos = 0;
+    Cycle next = 0;
+
+    // Cycle of the most recently stored record
+    Cycle last = 0;
+
+    // Indicates that the recorder itself is applying an input
+    bool injecting = false;
+
+    // Fingerprint of the most recently emulated frame (playback only)
+    Cycle frameCycle = -1;
+    u64 frameHash = 0;
+
+    // Statistics
+    isize records = 0;
+    isize mismatches = 0;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    using SubComponent::SubComponent;
+
+
+    //
+    // Methods from AmigaObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "InputRecorder"; }
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Methods from AmigaComponent
+    //
+
+private:
+
+    void _reset(bool hard) override;
+    void _didLoad() override;
+
+    isize _size() override { return 0; }
+    u64 _checksum() override { return 0; }
+    isize _load(const u8 *buffer) override { return 0; }
+    isize _save(u8 *buffer) override { return 0; }
+
+
+    //
+    // Recording and playing back
+    //
+
+public:
+
+    bool isRecording() const { return state == State::record; }
+    bool isPlaying() const { return state == State::play; }
+
+    // Performs a hard reset and starts recording all inputs
+    void startRecording(const fs::path &path) throws;
+
+    // Performs a hard reset and plays back a previously recorded file
+    void startPlayback(const fs::path &path) throws;
+
+    // Stops recording or playing back (a recording is written to disk)
+    void stop() throws;
+
+
+    //
+    // Intercepting inputs
+    //
+
+public:
+
+    /* Passes an input through the recorder. The function is called by all
+     * input handlers before the input is applied. It records the input if a
+     * recording is in progress. The return value is false if the input needs
+     * to be discarded, which is the case for all live inputs during playback.
+     */
+    bool intercept(const Cmd &cmd) {
+        return state == State::idle ? true : filter(cmd); }
+    bool interceptSerial(u16 value) {
+        return state == State::idle ? true : filterSerial(value); }
+
+    // Records or checks the fingerprint of the current frame
+    void vsyncHandler() { if (state != State::idle) processFrame(); }
+
+private:
+
+    bool filter(const Cmd &cmd);
+    bool filterSerial(u16 value);
+    void processFrame();
+
+    // Computes the fingerprint of the most recently emulated frame
+    u64 frameFingerprint() const;
+
+
+    //
+    // Encoding and decoding records
+    //
+
+private:
+
+    void write8(u8 value) { data.push_back(value); }
+    void write64(u64 value);
+    void writeVarint(u64 value);
+    void beginRecord(u8 type);
+
+    u8 read8();
+    u64 read64();
+    u64 readVarint();
+
+    // Decodes the cycle of the next record and schedules the INP event
+    void scheduleNext();
+
+    // Decodes and applies the next record
+    void applyNext();
+
+
+    //
+    // Servicing events
+    //
+
+public:
+
+    void serviceInputEvent();
+};
@@ -186,6 +186,8 @@ OSDebugger::isValidPtr(u32 addr) const
 bool
 OSDebugger::searchLibrary(u32 addr, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> libraries;
     read(getExecBase().LibList.lh_Head, libraries);
     
@@ -204,6 +206,8 @@ OSDebugger::searchLibrary(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchLibrary(const string &name, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> libraries;
     read(getExecBase().LibList.lh_Head, libraries);
 
@@ -225,6 +229,8 @@ OSDebugger::searchLibrary(const string &name, os::Library &result) const
 bool
 OSDebugger::searchDevice(u32 addr, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> devices;
     read(getExecBase().DeviceList.lh_Head, devices);
     
@@ -243,6 +249,8 @@ OSDebugger::searchDevice(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchDevice(const string &name, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> devices;
     read(getExecBase().DeviceList.lh_Head, devices);
     
@@ -264,6 +272,8 @@ OSDebugger::searchDevice(const string &name, os::Library &result) const
 bool
 OSDebugger::searchResource(u32 addr, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> resources;
     read(getExecBase().ResourceList.lh_Head, resources);
     
@@ -282,6 +292,8 @@ OSDebugger::searchResource(u32 addr, os::Library &result) const
 bool
 OSDebugger::searchResource(const string &name, os::Library &result) const
 {
+    INSPECTING
+    
     std::vector <os::Library> resources;
     read(getExecBase().ResourceList.lh_Head, resources);
     
@@ -303,6 +315,8 @@ OSDebugger::searchResource(const string &name, os::Library &result) const
 bool
 OSDebugger::searchTask(u32 addr, os::Task &result) const
 {
+    INSPECTING
+    
     std::vector <os::Task> tasks;
     read(tasks);
     
@@ -321,6 +335,8 @@ OSDebugger::searchTask(u32 addr, os::Task &result) const
 bool
 OSDebugger::searchTask(const string &name, os::Task &result) const
 {
+    INSPECTING
+    
     std::vector <os::Task> tasks;
     read(tasks);
     
@@ -343,6 +359,8 @@ OSDebugger::searchTask(const string &name, os::Task &result) const
 bool
 OSDebugger::searchProcess(u32 addr, os::Process &result) const
 {
+    INSPECTING
+    
     try {
         std::vector <os::Process> processes;
         read(processes);
@@ -363,6 +381,8 @@ OSDebugger::searchProcess(u32 addr, os::Process &result) const
 bool
 OSDebugger::searchProcess(const string &name, os::Process &result) const
 {
+    INSPECTING
+    
     try {
         std::vector <os::Process> processes;
         read(processes);
@@ -417,7 +437,10 @@ OSDebugger::checkExecBase(const os::ExecBase &execBase) const
     // Check if words in the range [0x22 ; 0x52] sum up to 0xFFFF
     u16 checksum = 0;
     for (u32 offset = 0x22; offset <= 0x52; offset += 2) {
-        checksum += mem.spypeek16 <ACCESSOR_CPU> (execBase.addr + offset);
+        
+        u16 word;
+        read(execBase.addr + offset, &word);
+        checksum += word;
     }
     if (!(checksum == 0xFFFF)) {
         throw VAError(ERROR_OSDB, "ExecBase: Checksum mismatch");
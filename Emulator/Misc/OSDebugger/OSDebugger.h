@@ -12,10 +12,73 @@
 #include "OSDebuggerTypes.h"
 #include "SubComponent.h"
 #include "Constants.h"
+#include <unordered_map>
+
+/* Groups all memory accesses of a code block into a single inspection. Inside
+ * an inspection, memory is fetched in chunks which are reused by all reads
+ * until the outermost inspection has finished.
+ */
+#define INSPECTING Inspection _insp(*this);
 
 class OSDebugger : public SubComponent {
     
-private:
+    //
+    // Caching
+    //
+    
+    // Memory is fetched in chunks of this size
+    static constexpr isize chunkSize = 256;
+    static constexpr isize cacheSize = 64;
+
+    struct Chunk {
+
+        u32 addr;
+        u8 data[chunkSize];
+    };
+
+    /* Chunks fetched during the current inspection. The cache is direct-mapped
+     * and a line is valid if its stamp matches the current stamp. Hence, the
+     * whole cache is invalidated by bumping the stamp.
+     */
+    mutable Chunk cache[cacheSize];
+    mutable i64 cacheStamp[cacheSize] = { };
+    mutable i64 stamp = 1;
+
+    // Nesting depth of the current inspection
+    mutable isize depth = 0;
+
+    // If set, all fetched chunks are recorded in this vector
+    mutable std::vector<Chunk> *trace = nullptr;
+
+    // A decoded result and the memory chunks it has been derived from
+    template <class T> struct Memo {
+
+        bool valid = false;
+        std::vector<Chunk> chunks;
+        std::vector<T> result;
+    };
+
+    mutable Memo<os::Task> taskMemo;
+    mutable Memo<os::Process> processMemo;
+    mutable std::unordered_map<u32, Memo<os::Library>> libraryMemo;
+
+    // Scope guard used by the INSPECTING macro
+    struct Inspection {
+
+        const OSDebugger &dbg;
+
+        Inspection(const OSDebugger &ref) : dbg(ref) {
+
+            dbg.mutex.lock();
+            dbg.depth++;
+        }
+        ~Inspection() {
+
+            if (--dbg.depth == 0) dbg.stamp++;
+            dbg.mutex.unlock();
+        }
+    };
+
     
     //
     // Constructing
@@ -72,6 +135,26 @@ private:
     void append(string &str, const char *cstr) const;
     
     
+    //
+    // Accessing the cache
+    //
+    
+private:
+    
+    // Returns the cached chunk containing the specified address
+    const u8 *fetch(u32 addr) const;
+    
+    // Reads a byte via the cache
+    u8 cachedPeek8(u32 addr) const { return fetch(addr)[addr % chunkSize]; }
+    
+    // Checks if all chunks still match the contents of memory
+    bool unchanged(const std::vector<Chunk> &chunks) const;
+    
+    // Computes a result or reuses a cached one if memory hasn't changed
+    template <class T, class F>
+    void memoize(Memo<T> &memo, std::vector<T> &result, F compute) const;
+    
+    
     //
     // Managing pointers
     //
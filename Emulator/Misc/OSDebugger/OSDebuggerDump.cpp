@@ -18,6 +18,7 @@ void
 OSDebugger::dumpInfo(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
 
         using namespace util;
         auto execBase = getExecBase();
@@ -57,6 +58,7 @@ void
 OSDebugger::dumpExecBase(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
 
         using namespace util;
         auto execBase = getExecBase();
@@ -145,6 +147,7 @@ OSDebugger::dumpIntVectors(std::ostream& s)
     };
     
     {   SUSPENDED
+        INSPECTING
 
         using namespace util;
         auto execBase = getExecBase();
@@ -162,6 +165,7 @@ void
 OSDebugger::dumpIntVector(std::ostream& s, const os::IntVector &intVec)
 {
     {   SUSPENDED
+        INSPECTING
                 
         os::Interrupt irq;
         read(intVec.iv_Node, &irq);
@@ -187,6 +191,7 @@ void
 OSDebugger::dumpLibraries(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
         
         std::vector <os::Library> libraries;
         read(getExecBase().LibList.lh_Head, libraries);
@@ -202,6 +207,7 @@ void
 OSDebugger::dumpLibrary(std::ostream& s, u32 addr)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library library;
         
@@ -215,6 +221,7 @@ void
 OSDebugger::dumpLibrary(std::ostream& s, const string &name)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library library;
         
@@ -228,6 +235,7 @@ void
 OSDebugger::dumpLibrary(std::ostream& s, const os::Library &lib, bool verbose)
 {
     {   SUSPENDED
+        INSPECTING
         
         using namespace util;
         
@@ -275,6 +283,7 @@ void
 OSDebugger::dumpDevices(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
         
         std::vector <os::Library> devices;
         read(getExecBase().DeviceList.lh_Head, devices);
@@ -289,6 +298,7 @@ void
 OSDebugger::dumpDevice(std::ostream& s, u32 addr)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library device;
         
@@ -302,6 +312,7 @@ void
 OSDebugger::dumpDevice(std::ostream& s, const string &name)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library device;
         
@@ -315,6 +326,7 @@ void
 OSDebugger::dumpDevice(std::ostream& s, const os::Library &lib, bool verbose)
 {
     {   SUSPENDED
+        INSPECTING
         
         dumpLibrary(s, lib, verbose);
     }
@@ -324,6 +336,7 @@ void
 OSDebugger::dumpResources(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
         
         std::vector <os::Library> resources;
         read(getExecBase().DeviceList.lh_Head, resources);
@@ -338,6 +351,7 @@ void
 OSDebugger::dumpResource(std::ostream& s, u32 addr)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library resource;
         
@@ -351,6 +365,7 @@ void
 OSDebugger::dumpResource(std::ostream& s, const string &name)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Library resource;
         
@@ -364,6 +379,7 @@ void
 OSDebugger::dumpResource(std::ostream& s, const os::Library &lib, bool verbose)
 {
     {   SUSPENDED
+        INSPECTING
         
         dumpLibrary(s, lib, verbose);
     }
@@ -373,6 +389,7 @@ void
 OSDebugger::dumpTasks(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
         
         std::vector <os::Task> tasks;
         read(tasks);
@@ -387,6 +404,7 @@ void
 OSDebugger::dumpTask(std::ostream& s, u32 addr)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Task task;
         
@@ -400,6 +418,7 @@ void
 OSDebugger::dumpTask(std::ostream& s, const string &name)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Task task;
         
@@ -413,6 +432,7 @@ void
 OSDebugger::dumpTask(std::ostream& s, const os::Task &task, bool verbose)
 {
     {   SUSPENDED
+        INSPECTING
         
         using namespace util;
         
@@ -489,6 +509,7 @@ void
 OSDebugger::dumpProcess(std::ostream& s, u32 addr)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Process process;
         
@@ -502,6 +523,7 @@ void
 OSDebugger::dumpProcess(std::ostream& s, const string &name)
 {
     {   SUSPENDED
+        INSPECTING
         
         os::Process process;
         
@@ -515,6 +537,7 @@ void
 OSDebugger::dumpProcesses(std::ostream& s)
 {
     {   SUSPENDED
+        INSPECTING
         
         std::vector <os::Process> processes;
         read(processes);
@@ -529,6 +552,7 @@ void
 OSDebugger::dumpProcess(std::ostream& s, const os::Process &process, bool verbose)
 {
     {   SUSPENDED
+        INSPECTING
         
         using namespace util;
         
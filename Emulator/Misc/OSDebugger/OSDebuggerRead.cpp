@@ -12,22 +12,104 @@
 #include "IOUtils.h"
 #include "Memory.h"
 
+const u8 *
+OSDebugger::fetch(u32 addr) const
+{
+    auto base = addr & ~u32(chunkSize - 1);
+    auto line = (base / chunkSize) % cacheSize;
+    auto &chunk = cache[line];
+
+    if (cacheStamp[line] != stamp || chunk.addr != base) {
+
+        // Pull in the whole chunk with a single bulk read
+        chunk.addr = base;
+        mem.spypeek <ACCESSOR_CPU> (base, chunkSize, chunk.data);
+        cacheStamp[line] = stamp;
+
+        if (trace) trace->push_back(chunk);
+    }
+
+    return chunk.data;
+}
+
+bool
+OSDebugger::unchanged(const std::vector<Chunk> &chunks) const
+{
+    u8 buffer[chunkSize];
+
+    for (auto &chunk : chunks) {
+
+        mem.spypeek <ACCESSOR_CPU> (chunk.addr, chunkSize, buffer);
+        if (std::memcmp(buffer, chunk.data, chunkSize)) return false;
+    }
+    return true;
+}
+
+template <class T, class F> void
+OSDebugger::memoize(Memo<T> &memo, std::vector<T> &result, F compute) const
+{
+    if (!memo.valid || !unchanged(memo.chunks)) {
+
+        // Recompute the result and record all chunks it is derived from
+        std::vector<Chunk> chunks;
+        std::vector<T> values;
+
+        auto outer = trace;
+        trace = &chunks;
+        memo.valid = false;
+
+        // Drop all cached chunks to make sure that every access is recorded
+        stamp++;
+
+        try { compute(values); } catch (...) { trace = outer; throw; }
+        trace = outer;
+
+        // Get rid of duplicates
+        std::sort(chunks.begin(), chunks.end(), [](auto &a, auto &b) {
+            return a.addr < b.addr; });
+        chunks.erase(std::unique(chunks.begin(), chunks.end(), [](auto &a, auto &b) {
+            return a.addr == b.addr; }), chunks.end());
+
+        memo.chunks = std::move(chunks);
+        memo.result = std::move(values);
+        memo.valid = true;
+    }
+
+    // An enclosing computation depends on the same chunks
+    if (trace) trace->insert(trace->end(), memo.chunks.begin(), memo.chunks.end());
+
+    result.insert(result.end(), memo.result.begin(), memo.result.end());
+}
+
 void
 OSDebugger::read(u32 addr, u8 *result) const
 {
-    *result = mem.spypeek8 <ACCESSOR_CPU> (addr);
+    if (depth) {
+        *result = cachedPeek8(addr);
+    } else {
+        *result = mem.spypeek8 <ACCESSOR_CPU> (addr);
+    }
 }
 
 void
 OSDebugger::read(u32 addr, u16 *result) const
 {
-    *result = mem.spypeek16 <ACCESSOR_CPU> (addr);
+    if (depth) {
+        *result = HI_LO(cachedPeek8(addr), cachedPeek8(addr + 1));
+    } else {
+        *result = mem.spypeek16 <ACCESSOR_CPU> (addr);
+    }
 }
 
 void
 OSDebugger::read(u32 addr, u32 *result) const
 {
-    *result = mem.spypeek32 <ACCESSOR_CPU> (addr);
+    if (depth) {
+        *result = HI_HI_LO_LO(cachedPeek8(addr), cachedPeek8(addr + 1),
+                              cachedPeek8(addr + 2), cachedPeek8(addr + 3));
+    } else {
+        *result = mem.spypeek32 <ACCESSOR_CPU> (addr);
+    }
 }
 
 void
@@ -41,9 +123,11 @@ OSDebugger::read(u32 addr, string &result, isize limit) const
 {
     if (!isRamOrRomPtr(addr)) return;
     
+    INSPECTING
+    
     for (isize i = 0; i < limit; i++, addr++) {
 
-        auto c = (char)mem.spypeek8 <ACCESSOR_CPU> (addr);
+        auto c = (char)cachedPeek8(addr);
         
         if (c <= 0 || c == '\r' || c == '\n') break;
         if (isprint(c)) result += c;
@@ -58,9 +142,13 @@ OSDebugger::read(u32 addr, string &result, isize limit) const
 os::ExecBase
 OSDebugger::getExecBase() const
 {
+    INSPECTING
+    
     os::ExecBase result;
+    u32 addr;
     
-    read(mem.spypeek32 <ACCESSOR_CPU> (4), &result);
+    read(4, &addr);
+    read(addr, &result);
     checkExecBase(result);
     
     return result;
@@ -71,6 +159,8 @@ OSDebugger::read(u32 addr, os::CommandLineInterface *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr +  0, &result->cli_Result2);
@@ -97,6 +187,8 @@ OSDebugger::read(u32 addr, os::ExecBase *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,   &result->LibNode);
@@ -180,6 +272,8 @@ OSDebugger::read(u32 addr, os::Interrupt *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->is_Node);
@@ -193,6 +287,8 @@ OSDebugger::read(u32 addr, os::IntVector *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->iv_Data);
@@ -206,6 +302,8 @@ OSDebugger::read(u32 addr, os::IOStdReq *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->io_Message);
@@ -226,6 +324,8 @@ OSDebugger::read(u32 addr, os::Library *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->lib_Node);
@@ -246,6 +346,8 @@ OSDebugger::read(u32 addr, os::List *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->lh_Head);
@@ -261,6 +363,8 @@ OSDebugger::read(u32 addr, os::MinList *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->mlh_Head);
@@ -274,6 +378,8 @@ OSDebugger::read(u32 addr, os::Message *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->mn_Node);
@@ -287,6 +393,8 @@ OSDebugger::read(u32 addr, os::MsgPort *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->mp_Node);
@@ -302,6 +410,8 @@ OSDebugger::read(u32 addr, os::Node *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr +  0, &result->ln_Succ);
@@ -317,6 +427,8 @@ OSDebugger::read(u32 addr, os::Process *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,   &result->pr_Task);
@@ -353,6 +465,8 @@ OSDebugger::read(u32 addr, os::SoftIntList *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
         result->addr = addr;
         
         read(addr + 0,  &result->sh_List);
@@ -365,6 +479,8 @@ OSDebugger::read(u32 addr, os::Task *result) const
 {
     if (isValidPtr(addr)) {
         
+        INSPECTING
+        
     result->addr = addr;
         
         read(addr + 0,  &result->tc_Node);
@@ -399,36 +515,48 @@ OSDebugger::read(u32 addr, os::Task *result) const
 void
 OSDebugger::read(std::vector <os::Task> &result) const
 {
-    auto execBase = getExecBase();
-        
-    os::Task current;
-    read(execBase.ThisTask, &current);
+    INSPECTING
     
-    result.push_back(current);
-    read(execBase.TaskReady.lh_Head, result);
-    read(execBase.TaskWait.lh_Head, result);
+    memoize(taskMemo, result, [&](std::vector <os::Task> &result) {
+        
+        auto execBase = getExecBase();
+        
+        os::Task current;
+        read(execBase.ThisTask, &current);
+        
+        result.push_back(current);
+        read(execBase.TaskReady.lh_Head, result);
+        read(execBase.TaskWait.lh_Head, result);
+    });
 }
 
 void
 OSDebugger::read(std::vector <os::Process> &result) const
 {
-    std::vector <os::Task> tasks;
-    read(tasks);
+    INSPECTING
     
-    for (auto &t : tasks) {
+    memoize(processMemo, result, [&](std::vector <os::Process> &result) {
         
-        if (t.tc_Node.ln_Type == os::NT_PROCESS) {
+        std::vector <os::Task> tasks;
+        read(tasks);
+        
+        for (auto &t : tasks) {
             
-            os::Process process;
-            read(t.addr, &process);
-            result.push_back(process);
+            if (t.tc_Node.ln_Type == os::NT_PROCESS) {
+                
+                os::Process process;
+                read(t.addr, &process);
+                result.push_back(process);
+            }
         }
-    }
+    });
 }
 
 void
 OSDebugger::read(u32 addr, std::vector <os::Task> &result) const
 {
+    INSPECTING
+    
     for (isize i = 0; isValidPtr(addr) && i < 128; i++) {
                 
         os::Task task;
@@ -442,19 +570,26 @@ OSDebugger::read(u32 addr, std::vector <os::Task> &result) const
 void
 OSDebugger::read(u32 addr, std::vector <os::Library> &result) const
 {
-    for (isize i = 0; isValidPtr(addr) && i < 128; i++) {
-        
-        os::Library library;
-        read(addr, &library);
+    INSPECTING
+    
+    memoize(libraryMemo[addr], result, [&](std::vector <os::Library> &result) {
         
-        addr = library.lib_Node.ln_Succ;
-        if (addr) result.push_back(library);
-    }
+        for (isize i = 0; isValidPtr(addr) && i < 128; i++) {
+            
+            os::Library library;
+            read(addr, &library);
+            
+            addr = library.lib_Node.ln_Succ;
+            if (addr) result.push_back(library);
+        }
+    });
 }
 
 void
 OSDebugger::read(const string &prName, os::SegList &result) const
 {
+    INSPECTING
+    
     os::Process process;
     if (searchProcess(prName, process)) {
         
@@ -476,7 +611,9 @@ OSDebugger::read(const os::Process &pr, os::SegList &result) const
      *   which is an array of SegLists. In this case, we will find the segments
      *   in the third list.
      */
-        
+    
+    INSPECTING
+    
     if (pr.pr_CLI && pr.pr_TaskNum) {
 
         os::CommandLineInterface cli;
@@ -485,9 +622,11 @@ OSDebugger::read(const os::Process &pr, os::SegList &result) const
         
     } else if (isValidPtr(BPTR(pr.pr_SegList))) {
         
-        auto size = mem.spypeek32 <ACCESSOR_CPU> (BPTR(pr.pr_SegList));
+        u32 size, addr;
+        
+        read(BPTR(pr.pr_SegList), &size);
         if (size >= 3) {
-            auto addr = mem.spypeek32 <ACCESSOR_CPU> (BPTR(pr.pr_SegList) + 12);
+            read(BPTR(pr.pr_SegList) + 12, &addr);
             read(BPTR(addr), result);
         }
     }
@@ -496,13 +635,17 @@ OSDebugger::read(const os::Process &pr, os::SegList &result) const
 void
 OSDebugger::read(u32 addr, os::SegList &result) const
 {
+    INSPECTING
+    
     for (isize i = 0; isValidPtr(addr) && i < 128; i++) {
         
-        auto size = mem.spypeek32 <ACCESSOR_CPU> (addr - 4) - 8;
-        auto next = mem.spypeek32 <ACCESSOR_CPU> (addr);
+        u32 size, next;
+        
+        read(addr - 4, &size);
+        read(addr, &next);
         auto data = addr + 4;
         
-        result.push_back(std::make_pair(data, size));
+        result.push_back(std::make_pair(data, size - 8));
         addr = BPTR(next);
     }
 }
@@ -10,9 +10,12 @@
 #include "config.h"
 #include "RegressionTester.h"
 #include "Amiga.h"
+#include "Checksum.h"
 #include "IOUtils.h"
+#include "StringUtils.h"
 
 #include <fstream>
+#include <sstream>
 
 void
 RegressionTester::prepare(ConfigScheme scheme, string kickstart)
@@ -55,35 +58,78 @@ RegressionTester::dumpTexture(Amiga &amiga)
 }
 
 void
-RegressionTester::dumpTexture(Amiga &amiga, const string &filename)
+RegressionTester::loadManifest(const string &path)
 {
-    /* This function is used for automatic regression testing. It generates a
-     * TIFF image of the current emulator texture in the /tmp directory and
-     * exits the application. The regression testing script will pick up the
-     * texture and compare it against a previously recorded reference image.
+    /* The manifest contains a line for each test case. Each line consists of
+     * the golden hash (a SHA-256 digest in hexadecimal notation) and the name
+     * of the test image.
+     * This is the same format the tester prints when a screenshot is taken.
      */
-    std::ofstream file;
-        
-    // Assemble the target file names
-    string rawFile = "/tmp/" + filename + ".raw";
-    string tiffFile = "/tmp/" + filename + ".tiff";
+    std::ifstream stream(path);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_NOT_FOUND, path);
 
-    // Open an output stream
-    file.open(rawFile.c_str());
-    
-    // Dump texture
-    dumpTexture(amiga, file);
-    file.close();
-    
-    // Convert raw data into a TIFF file
-    string cmd = "/usr/local/bin/raw2tiff";
-    cmd += " -p rgb -b 3";
-    cmd += " -w " + std::to_string(x2 - x1);
-    cmd += " -l " + std::to_string(y2 - y1);
-    cmd += " " + rawFile + " " + tiffFile;
+    goldenHashes.clear();
     
-    if (system(cmd.c_str()) == -1) {
-        warn("Error executing %s\n", cmd.c_str());
+    string line;
+    while (std::getline(stream, line)) {
+
+        std::istringstream iss(line);
+        string hash, name;
+
+        // Skip empty lines and comments
+        if (!(iss >> hash) || hash[0] == '#') continue;
+
+        if (!(iss >> name)) throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+
+        if (hash.size() != 64 || hash.find_first_not_of("0123456789abcdefABCDEF") != string::npos) {
+            throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+        }
+        goldenHashes[name] = util::lowercased(hash);
+    }
+
+    manifestPath = path;
+}
+
+void
+RegressionTester::dumpTexture(Amiga &amiga, const string &filename)
+{
+    /* This function is used for automatic regression testing. It computes a
+     * fingerprint of the current emulator texture and exits the application.
+     * If a manifest is present, the fingerprint is checked against the golden
+     * hash and the exit code indicates the result. Otherwise, or if the check
+     * fails, a PPM image of the texture is written to the /tmp directory. The
+     * regression testing script may then compare it against a previously
+     * recorded reference image.
+     */
+    auto rgb = grabTexture(amiga);
+    auto hash = util::sha256(rgb.data(), isize(rgb.size()));
+    auto imageFile = "/tmp/" + filename + ".ppm";
+
+    // Report the fingerprint in manifest format
+    msg("%s %s\n", hash.c_str(), filename.c_str());
+
+    if (manifestPath.empty()) {
+
+        writeImage(imageFile, rgb);
+
+    } else if (auto it = goldenHashes.find(filename); it == goldenHashes.end()) {
+
+        warn("%s: No golden hash found in %s\n", filename.c_str(), manifestPath.c_str());
+        writeImage(imageFile, rgb);
+        if (!retValue) retValue = 1;
+
+    } else if (it->second != hash) {
+
+        warn("%s: Hash mismatch (expected %s)\n", filename.c_str(), it->second.c_str());
+        writeImage(imageFile, rgb);
+
+        // Visualize the differences if a reference image is available
+        std::vector<u8> ref;
+        auto refFile = util::extractPath(manifestPath) + filename + ".ppm";
+        if (readImage(refFile, ref) && ref.size() == rgb.size()) {
+            writeImage("/tmp/" + filename + ".diff.ppm", diffImage(rgb, ref));
+        }
+        if (!retValue) retValue = 1;
     }
     
     // Ask the GUI to quit
@@ -93,6 +139,16 @@ RegressionTester::dumpTexture(Amiga &amiga, const string &filename)
 void
 RegressionTester::dumpTexture(Amiga &amiga, std::ostream& os)
 {
+    auto rgb = grabTexture(amiga);
+    os.write((const char *)rgb.data(), rgb.size());
+}
+
+std::vector<u8>
+RegressionTester::grabTexture(Amiga &amiga)
+{
+    std::vector<u8> result;
+    result.reserve(3 * (x2 - x1) * (y2 - y1));
+
     {   SUSPENDED
         
         auto &buffer = amiga.denise.pixelEngine.getStableBuffer();
@@ -101,13 +157,74 @@ RegressionTester::dumpTexture(Amiga &amiga, std::ostream& os)
             
             for (isize x = x1; x < x2; x++) {
                 
-                char *cptr = (char *)(buffer.ptr + y * HPIXELS + x);
-                os.write(cptr + 0, 1);
-                os.write(cptr + 1, 1);
-                os.write(cptr + 2, 1);
+                u8 *cptr = (u8 *)(buffer.ptr + y * HPIXELS + x);
+                result.insert(result.end(), cptr, cptr + 3);
             }
         }
     }
+    
+    return result;
+}
+
+bool
+RegressionTester::readImage(const string &path, std::vector<u8> &rgb) const
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) return false;
+
+    string magic;
+    isize width, height, maxval;
+
+    stream >> magic >> width >> height >> maxval;
+    if (magic != "P6" || maxval != 255 || stream.get() == EOF) return false;
+    if (width != x2 - x1 || height != y2 - y1) return false;
+
+    rgb.resize(3 * width * height);
+    stream.read((char *)rgb.data(), rgb.size());
+    
+    return stream.gcount() == isize(rgb.size());
+}
+
+void
+RegressionTester::writeImage(const string &path, const std::vector<u8> &rgb) const
+{
+    std::ofstream stream(path, std::ios::binary);
+    
+    if (!stream.is_open()) {
+        
+        warn("Can't write %s\n", path.c_str());
+        return;
+    }
+    
+    stream << "P6\n" << (x2 - x1) << " " << (y2 - y1) << "\n255\n";
+    stream.write((const char *)rgb.data(), rgb.size());
+}
+
+std::vector<u8>
+RegressionTester::diffImage(const std::vector<u8> &rgb,
+                            const std::vector<u8> &ref) const
+{
+    assert(rgb.size() == ref.size());
+    
+    std::vector<u8> result(rgb.size());
+
+    for (usize i = 0; i < rgb.size(); i += 3) {
+
+        if (rgb[i] == ref[i] && rgb[i+1] == ref[i+1] && rgb[i+2] == ref[i+2]) {
+
+            // Matching pixels are drawn as a dimmed gray value
+            auto gray = u8((rgb[i] + rgb[i+1] + rgb[i+2]) / 12);
+            result[i] = result[i+1] = result[i+2] = gray;
+
+        } else {
+
+            // Differing pixels are drawn in red
+            result[i] = 0xFF;
+            result[i+1] = result[i+2] = 0;
+        }
+    }
+
+    return result;
 }
 
 void
@@ -12,6 +12,8 @@
 #include "SubComponent.h"
 #include "Constants.h"
 #include "AmigaTypes.h"
+#include <map>
+#include <vector>
 
 class RegressionTester : public SubComponent {
 
@@ -19,6 +21,12 @@ public:
         
     // Filename of the test image
     string dumpTexturePath = "texture";
+
+    /* Location of the golden-hash manifest. If a manifest has been loaded,
+     * the fingerprint of the test image is compared against the golden hash
+     * and the image is only written to disk if the comparison fails.
+     */
+    string manifestPath;
     
     // Texture cutout
     isize x1 = 4 * 0x31;
@@ -31,6 +39,9 @@ private:
     // When the emulator exits, this value is returned to the test script
     u8 retValue = 0;
 
+    // Golden hashes read from the manifest
+    std::map<string, string> goldenHashes;
+
     
     //
     // Constructing
@@ -82,11 +93,27 @@ public:
     // Runs a test case
     void run(string adf);
     
+    // Reads the golden hashes from a manifest file
+    void loadManifest(const string &path) throws;
+
     // Creates the test image and exits the emulator
     void dumpTexture(class Amiga &amiga);
     void dumpTexture(class Amiga &amiga, const string &filename);
     void dumpTexture(class Amiga &amiga, std::ostream& os);
 
+private:
+
+    // Returns the texture cutout as a sequence of RGB triples
+    std::vector<u8> grabTexture(class Amiga &amiga);
+
+    // Reads or writes a texture cutout in PPM format
+    bool readImage(const string &path, std::vector<u8> &rgb) const;
+    void writeImage(const string &path, const std::vector<u8> &rgb) const;
+
+    // Creates an image highlighting all pixels that differ
+    std::vector<u8> diffImage(const std::vector<u8> &rgb,
+                              const std::vector<u8> &ref) const;
+
     
     //
     // Handling errors
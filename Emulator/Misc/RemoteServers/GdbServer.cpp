@@ -68,11 +68,22 @@ string
 GdbServer::doReceive()
 {
     auto cmd = connection.recv();
-    
+
+    // Large packets may arrive in pieces. Read on until the checksum is present
+    if (auto start = cmd.find('$'); start != string::npos) {
+
+        for (auto end = cmd.find('#', start);
+             end == string::npos || cmd.length() < end + 3;
+             end = cmd.find('#', start)) {
+
+            cmd += connection.recv();
+        }
+    }
+
     // Remove LF and CR (if present)
     cmd = util::rtrim(cmd, "\n\r");
     // Remove trailing '\0'
-    while (cmd[cmd.length()-1] <= 0) {
+    while (!cmd.empty() && cmd[cmd.length()-1] <= 0) {
         cmd.pop_back();
     }
     if (config.verbose) {
@@ -241,10 +252,99 @@ GdbServer::readRegister(isize nr)
 }
 
 string
-GdbServer::readMemory(isize addr)
+GdbServer::readMemory(isize addr, isize len)
+{
+    if (len <= 0) return "";
+
+    std::vector<u8> buf(len);
+    string result(2 * len, '0');
+
+    // Read the whole range in one go
+    mem.spypeek <ACCESSOR_CPU> ((u32)addr, len, buf.data());
+
+    // Convert four bytes at a time by spreading their nibbles to single bytes
+    auto src = buf.data();
+    auto dst = (u8 *)result.data();
+    isize i = 0;
+
+    for (; i + 4 <= len; i += 4, dst += 8) {
+
+        u64 v = R32BE(src + i);
+        v = (v | v << 16) & 0x0000FFFF0000FFFF;
+        v = (v | v << 8)  & 0x00FF00FF00FF00FF;
+        v = (v | v << 4)  & 0x0F0F0F0F0F0F0F0F;
+
+        // Map 0...9 to '0'...'9' and 10...15 to 'a'...'f'
+        auto letters = ((v + 0x0606060606060606) >> 4) & 0x0101010101010101;
+        v += 0x3030303030303030 + letters * 0x27;
+
+        W32BE(dst, u32(v >> 32));
+        W32BE(dst + 4, u32(v));
+    }
+    for (; i < len; i++, dst += 2) {
+
+        auto hex = util::hexstr <2> (src[i]);
+        dst[0] = hex[0];
+        dst[1] = hex[1];
+    }
+
+    return result;
+}
+
+bool
+GdbServer::writeMemory(isize addr, const u8 *buf, isize len)
+{
+    if (len <= 0) return true;
+
+    SUSPENDED
+
+    // Only allow writes to RAM and ROM areas
+    if (!mem.isPatchable((u32)addr, len)) return false;
+
+    mem.patch((u32)addr, (u8 *)buf, len);
+    return true;
+}
+
+string
+GdbServer::memoryMap()
 {
-    auto byte = mem.spypeek8 <ACCESSOR_CPU> ((u32)addr);
-    return util::hexstr <2> (byte);
+    string result;
+
+    result += "<?xml version=\"1.0\"?>\n";
+    result += "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" ";
+    result += "\"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n";
+    result += "<memory-map>\n";
+
+    // Classifies a memory bank (0 = unmapped, 1 = RAM or I/O, 2 = ROM)
+    auto type = [&](isize bank) {
+
+        switch (mem.cpuMemSrc[bank]) {
+
+            case MEM_NONE:          return 0;
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+            case MEM_WOM:
+            case MEM_EXT:           return 2;
+            default:                return 1;
+        }
+    };
+
+    // Merge adjacent banks of the same type into a single region
+    for (isize first = 0, last = 0; first < 256; first = last) {
+
+        auto t = type(first);
+        for (last = first + 1; last < 256 && type(last) == t; last++);
+
+        if (t) {
+
+            result += "  <memory type=\"" + string(t == 2 ? "rom" : "ram") + "\"";
+            result += " start=\"0x" + util::hexstr <8> (first << 16) + "\"";
+            result += " length=\"0x" + util::hexstr <8> ((last - first) << 16) + "\"/>\n";
+        }
+    }
+
+    result += "</memory-map>\n";
+    return result;
 }
 
 void
@@ -28,6 +28,7 @@ enum class GdbCmd
     TfV,
     TfP,
     TStatus,
+    Xfer,
     fThreadInfo,
 };
 
@@ -162,8 +163,14 @@ private:
     // Reads a register value
     string readRegister(isize nr);
 
-    // Reads a byte from memory
-    string readMemory(isize addr);
+    // Reads a memory range and returns its contents as a hex string
+    string readMemory(isize addr, isize len);
+
+    // Writes a memory range (returns false if it contains unwritable areas)
+    bool writeMemory(isize addr, const u8 *buf, isize len);
+
+    // Returns the memory map in the XML format used by GDB
+    string memoryMap();
 
     // Returns the current copper address
     string getCopperCurrentAddress();
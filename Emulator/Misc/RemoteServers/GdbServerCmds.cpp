@@ -30,7 +30,8 @@ GdbServer::process <' ', GdbCmd::CtrlC> (string arg)
 template <> void
 GdbServer::process <'q', GdbCmd::Supported> (string arg)
 {
-    reply("PacketSize=1ff;"
+    reply("PacketSize=" + util::hexstr <8> (Socket::BUFFER_SIZE) + ";"
+          "qXfer:memory-map:read+;"
           "multiprocess-;"
           "swbreak+;"
           "QStartNoAckMode+;"
@@ -75,6 +76,35 @@ GdbServer::process <'q', GdbCmd::TfP> (string arg)
     reply("l");
 }
 
+template <> void
+GdbServer::process <'q', GdbCmd::Xfer> (string arg)
+{
+    // Format: <object>:read:<annex>:<offset>,<length>
+    auto tokens = util::split(arg, ':');
+
+    if (tokens.size() == 4 && tokens[0] == "memory-map" && tokens[1] == "read") {
+
+        auto range = util::split(tokens[3], ',');
+        isize offset, length;
+
+        if (range.size() != 2 ||
+            !util::parseHex(range[0], &offset) ||
+            !util::parseHex(range[1], &length)) {
+            throw VAError(ERROR_GDB_INVALID_FORMAT, "qXfer");
+        }
+
+        // Transmit the requested chunk ('l' marks the last one)
+        auto map = memoryMap();
+        if (offset >= isize(map.length())) { reply("l"); return; }
+        auto chunk = map.substr(offset, length);
+        reply((offset + length >= isize(map.length()) ? "l" : "m") + chunk);
+        return;
+    }
+
+    // Other objects are not supported
+    reply("");
+}
+
 template <> void
 GdbServer::process <'q', GdbCmd::fThreadInfo> (string arg)
 {
@@ -239,6 +269,11 @@ GdbServer::process <'q'> (string cmd)
         process <'q', GdbCmd::C> ("");
         return;
     }
+    if (command == "Xfer") {
+
+        process <'q', GdbCmd::Xfer> (cmd.substr(5));
+        return;
+    }
     
     throw VAError(ERROR_GDB_UNSUPPORTED_CMD, "q");
 }
@@ -352,18 +387,20 @@ GdbServer::process <'m'> (string cmd)
     
     if (tokens.size() == 2) {
 
-        string result;
+        isize addr, size;
+
+        if (!util::parseHex(tokens[0], &addr) || !util::parseHex(tokens[1], &size)) {
+            throw VAError(ERROR_GDB_INVALID_FORMAT, "m");
+        }
 
-        isize addr;
-        util::parseHex(tokens[0], &addr);
-        isize size;
-        util::parseHex(tokens[1], &size);
+        // The hex-encoded reply must fit into a single packet
+        if (size > Socket::BUFFER_SIZE / 2) {
 
-        for (isize i = 0; i < size; i++) {
-            result += readMemory(addr + i);
+            reply("E01");
+            return;
         }
-        
-        reply(result);
+
+        reply(readMemory(addr, size));
 
     } else {
     
@@ -374,7 +411,61 @@ GdbServer::process <'m'> (string cmd)
 template <> void
 GdbServer::process <'M'> (string cmd)
 {
-    throw VAError(ERROR_GDB_UNSUPPORTED_CMD, "M");
+    // Format: <addr>,<length>:<hex data>
+    auto colon = cmd.find(':');
+    auto tokens = util::split(cmd.substr(0, colon), ',');
+    
+    isize addr, size;
+    
+    if (colon == string::npos || tokens.size() != 2 ||
+        !util::parseHex(tokens[0], &addr) ||
+        !util::parseHex(tokens[1], &size) ||
+        isize(cmd.length() - colon - 1) != 2 * size) {
+        throw VAError(ERROR_GDB_INVALID_FORMAT, "M");
+    }
+    
+    auto digit = [](char c) {
+        
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        throw VAError(ERROR_GDB_INVALID_FORMAT, "M");
+    };
+    
+    std::vector<u8> buf(size);
+    auto hex = cmd.c_str() + colon + 1;
+    for (isize i = 0; i < size; i++) {
+        buf[i] = u8(digit(hex[2 * i]) << 4 | digit(hex[2 * i + 1]));
+    }
+    
+    reply(writeMemory(addr, buf.data(), size) ? "OK" : "E01");
+}
+
+template <> void
+GdbServer::process <'X'> (string cmd)
+{
+    // Format: <addr>,<length>:<binary data>
+    auto colon = cmd.find(':');
+    auto tokens = util::split(cmd.substr(0, colon), ',');
+    
+    isize addr, size;
+    
+    if (colon == string::npos || tokens.size() != 2 ||
+        !util::parseHex(tokens[0], &addr) ||
+        !util::parseHex(tokens[1], &size)) {
+        throw VAError(ERROR_GDB_INVALID_FORMAT, "X");
+    }
+    
+    // Undo the escaping of '#', '$', '}', and '*' (0x7D followed by c ^ 0x20)
+    std::vector<u8> buf;
+    buf.reserve(cmd.length() - colon - 1);
+    for (auto i = colon + 1; i < cmd.length(); i++) {
+        buf.push_back(u8(cmd[i] == 0x7D && i + 1 < cmd.length() ? cmd[++i] ^ 0x20 : cmd[i]));
+    }
+    
+    if (isize(buf.size()) != size) throw VAError(ERROR_GDB_INVALID_FORMAT, "X");
+    
+    reply(writeMemory(addr, buf.data(), size) ? "OK" : "E01");
 }
 
 template <> void
@@ -517,6 +608,7 @@ GdbServer::process(char cmd, string package)
         case 'k' : process <'k'> (package); break;
         case 'm' : process <'m'> (package); break;
         case 'M' : process <'M'> (package); break;
+        case 'X' : process <'X'> (package); break;
         case 'p' : process <'p'> (package); break;
         case 'P' : process <'P'> (package); break;
         case 'c' : process <'c'> (package); break;
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "SerServer.h"
 #include "Agnus.h"
+#include "Amiga.h"
 #include "IOUtils.h"
 #include "RetroShell.h"
 #include "SerialPort.h"
@@ -152,8 +153,12 @@ SerServer::serviceSerEvent()
     } else {
     
         // Hand the oldest buffer element over to the UART
-        uart.receiveShiftReg = buffer.read();
-        uart.copyFromReceiveShiftRegister();
+        auto value = buffer.read();
+        if (inputRecorder.interceptSerial(value)) {
+
+            uart.receiveShiftReg = value;
+            uart.copyFromReceiveShiftRegister();
+        }
         processedBytes++;
         skippedTransmissions = 0;
     }
@@ -147,11 +147,11 @@ Socket::accept()
 std::string
 Socket::recv()
 {    
-    char buffer[BUFFER_SIZE + 1] = {};
-    if (auto n = ::recv(socket, buffer, BUFFER_SIZE, 0); n > 0) {
-        
-        // Convert the buffer to a string
-        string result = string(buffer, n);
+    // Receive directly into the result string (too large for the stack)
+    string result(BUFFER_SIZE, '\0');
+    if (auto n = ::recv(socket, result.data(), BUFFER_SIZE, 0); n > 0) {
+
+        result.resize(n);
         return result;
     }
     
@@ -169,8 +169,12 @@ Socket::send(u8 value)
 void
 Socket::send(const string &s)
 {
-    if (::send(socket, s.c_str(), (int)s.length(), 0) < 0) {
-        throw VAError(ERROR_SOCK_CANT_SEND);
+    // Large packets may be transmitted in multiple chunks
+    for (isize sent = 0, len = isize(s.length()); sent < len; ) {
+
+        auto n = ::send(socket, s.c_str() + sent, (int)(len - sent), 0);
+        if (n < 0) throw VAError(ERROR_SOCK_CANT_SEND);
+        sent += n;
     }
 }
 
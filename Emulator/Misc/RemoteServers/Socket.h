@@ -37,7 +37,7 @@ class Socket : public AmigaObject {
 public:
     
     // Size of the communication buffer
-    static constexpr isize BUFFER_SIZE = 512;
+    static constexpr isize BUFFER_SIZE = 0x10000;
     
     
     //
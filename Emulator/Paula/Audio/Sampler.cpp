@@ -9,6 +9,7 @@
 
 #include "config.h"
 #include "Sampler.h"
+#include <algorithm>
 
 void
 Sampler::reset()
@@ -17,9 +18,40 @@ Sampler::reset()
     clear();
 
     // Add a dummy element to ensure the buffer is not empty
+    base = 0;
     append(0,0);
 }
 
+void
+Sampler::append(Cycle clock, i16 sample)
+{
+    assert(!isFull());
+    assert(isEmpty() || key(prev(w)) <= clock);
+    
+    if (clock < base || clock - base > maxOffset) rebase(clock);
+    
+    elements[w] = sample;
+    offsets[w] = u32(clock - base);
+    w = next(w);
+}
+
+void
+Sampler::rebase(Cycle clock)
+{
+    /* Move the base to the oldest element if possible. If the buffer spans a
+     * time frame that can't be covered by 32-bit offsets (which only happens
+     * if the Muxer hasn't consumed samples for more than a minute), the
+     * oldest time stamps are clamped.
+     */
+    Cycle newBase = isEmpty() ? clock : std::max(key(r), clock - maxOffset);
+    newBase = std::min(newBase, clock);
+    
+    for (isize i = r; i != w; i = next(i)) {
+        offsets[i] = u32(std::max(key(i) - newBase, Cycle(0)));
+    }
+    base = newBase;
+}
+
 template <SamplingMethod method> i16
 Sampler::interpolate(Cycle clock)
 {
@@ -36,9 +68,12 @@ Sampler::interpolate(Cycle clock)
 
     isize r1 = r;
     isize r2 = next(r1);
+    
+    // Translate the target cycle into the time stamp format
+    Cycle t = clock - base;
 
     // Remove all outdated entries
-    while (r2 != w && keys[r2] <= clock) {
+    while (r2 != w && offsets[r2] <= t) {
         
         skip();
         r1 = r2;
@@ -50,7 +85,7 @@ Sampler::interpolate(Cycle clock)
     if (r2 == w) return elements[r1];
 
     // Make sure that we've selected the right sample pair
-    assert(clock >= keys[r1] && clock < keys[r2]);
+    assert(t >= offsets[r1] && t < offsets[r2]);
 
     // Interpolate between position r1 and r2
     if constexpr (method == SMP_NONE) {
@@ -60,14 +95,14 @@ Sampler::interpolate(Cycle clock)
     
     if constexpr (method == SMP_NEAREST) {
         
-        return ((clock - keys[r1]) < (keys[r2] - clock)) ? elements[r1] : elements[r2];
+        return ((t - offsets[r1]) < (offsets[r2] - t)) ? elements[r1] : elements[r2];
     }
     
     if constexpr (method == SMP_LINEAR) {
 
-        double dx = (double)(keys[r2] - keys[r1]);
+        double dx = (double)(offsets[r2] - offsets[r1]);
         double dy = (double)(elements[r2] - elements[r1]);
-        double weight = (double)(clock - keys[r1]) / dx;
+        double weight = (double)(t - offsets[r1]) / dx;
         
         return (i16)(elements[r1] + weight * dy);
     }
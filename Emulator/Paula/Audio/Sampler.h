@@ -19,13 +19,41 @@
  * at a constant sampling rate. Instead, a new sample is generated whenever the
  * period counter underflows. To preserve this timing information, each sample
  * is tagged by the cycle it was produced.
+ *
+ * To keep the memory footprint small, time stamps are stored as 32-bit
+ * offsets relative to a base cycle. The buffer is emptied once per frame by
+ * the Muxer. Hence, it only needs to hold the samples of a single frame. The
+ * smallest period accepted by the state machine is a single DMA cycle, which
+ * produces one sample per DMA cycle. The capacity is chosen accordingly.
  */
 
-struct Sampler : util::SortedRingBuffer <i16, VPOS_CNT * HPOS_CNT> {
+static constexpr isize SAMPLER_CAPACITY = VPOS_CNT * HPOS_CNT;
+
+struct Sampler : util::RingBuffer <i16, SAMPLER_CAPACITY> {
+    
+    // Maximum distance between the base cycle and a time stamp
+    static constexpr Cycle maxOffset = 0x7FFFFFFF;
+    
+    // Time stamps (relative to 'base')
+    u32 offsets[SAMPLER_CAPACITY];
+    
+    // Reference cycle for all time stamps
+    Cycle base = 0;
     
     // Initializes the ring buffer with a single dummy element
     void reset();
-     
+    
+    // Returns the time stamp of the element at the specified position
+    Cycle key(isize i) const { return base + offsets[i]; }
+    
+    // Adds a sample (time stamps must be provided in ascending order)
+    void append(Cycle clock, i16 sample);
+    
     // Interpolates a sound sample for the specified target cycle
     template <SamplingMethod method> i16 interpolate(Cycle clock);
+    
+private:
+    
+    // Moves the base cycle such that the specified cycle can be represented
+    void rebase(Cycle clock);
 };
@@ -60,6 +60,8 @@ StateMachine<nr>::_inspect() const
         info.audvolLatch = audvolLatch;
         info.audvol = audvol;
         info.auddat = auddat;
+
+        publishedInfo.write(info);
     }
 }
 
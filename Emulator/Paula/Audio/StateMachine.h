@@ -19,6 +19,7 @@ class StateMachine : public SubComponent {
 
     // Result of the latest inspection
     mutable StateMachineInfo info = {};
+    mutable util::Seqlock<StateMachineInfo> publishedInfo;
 
 public:
 
@@ -147,7 +148,7 @@ private:
     
 public:
     
-    StateMachineInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    StateMachineInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
         
     
     //
@@ -154,6 +154,8 @@ DiskController::_inspect() const
         for (isize i = 0; i < 6; i++) {
             info.fifo[i] = (fifo >> (8 * i)) & 0xFF;
         }
+
+        publishedInfo.write(info);
     }
 }
 
@@ -528,7 +530,7 @@ DiskController::performTurboDMA(FloppyDrive *drive)
             
         case DRIVE_DMA_WAIT:
             
-            drive->findSyncMark();
+            if (drive) drive->findSyncMark();
             [[fallthrough]];
             
         case DRIVE_DMA_READ:
@@ -556,21 +558,25 @@ DiskController::performTurboDMA(FloppyDrive *drive)
 void
 DiskController::performTurboRead(FloppyDrive *drive)
 {
-    for (isize i = 0; i < (dsklen & 0x3FFF); i++) {
-        
-        // Read word from disk
-        u16 word = drive->readWordAndRotate();
-        
-        // Write word into memory
-        if constexpr (DSK_CHECKSUM) {
-            
+    isize count = dsklen & 0x3FFF;
+    u8 buffer[2 * 0x3FFF];
+
+    // Read all words from disk
+    drive->readBlockAndRotate(buffer, 2 * count);
+
+    if constexpr (DSK_CHECKSUM) {
+
+        for (isize i = 0; i < count; i++) {
+
             checkcnt++;
-            check1 = util::fnvIt32(check1, word);
-            check2 = util::fnvIt32(check2, agnus.dskpt & agnus.ptrMask);
+            check1 = util::fnvIt32(check1, R16BE(buffer + 2 * i));
+            check2 = util::fnvIt32(check2, (agnus.dskpt + 2 * u32(i)) & agnus.ptrMask);
         }
-        mem.poke16 <ACCESSOR_AGNUS> (agnus.dskpt, word);
-        agnus.dskpt += 2;
     }
+
+    // Write all words into memory
+    mem.poke <ACCESSOR_AGNUS> (agnus.dskpt, 2 * count, buffer);
+    agnus.dskpt += u32(2 * count);
     
     debug(DSK_CHECKSUM, "Turbo read %s: cyl: %ld side: %ld offset: %ld ",
           drive->getDescription(),
@@ -21,6 +21,7 @@ class DiskController : public SubComponent
 
     // Result of the latest inspection
     mutable DiskControllerInfo info = {};
+    mutable util::Seqlock<DiskControllerInfo> publishedInfo;
     
     // The currently selected drive (-1 if no drive is selected)
     isize selected = -1;
@@ -167,7 +168,7 @@ public:
     
 public:
     
-    DiskControllerInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    DiskControllerInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
 
     //
@@ -99,6 +99,8 @@ Paula::_inspect() const
         info.intreq = intreq;
         info.intena = intena;
         info.adkcon = adkcon;        
+
+        publishedInfo.write(info);
     }
 }
 
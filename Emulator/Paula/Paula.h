@@ -25,6 +25,7 @@ private:
 
     // Result of the latest inspection
     mutable PaulaInfo info = {};
+    mutable util::Seqlock<PaulaInfo> publishedInfo;
 
     
     //
@@ -176,7 +177,7 @@ private:
     
 public:
     
-    PaulaInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    PaulaInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
     // AudioInfo getAudioInfo() const { return AmigaComponent::getInfo(audioInfo); }
 
 
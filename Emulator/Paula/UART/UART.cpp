@@ -35,6 +35,8 @@ UART::_inspect() const
     info.receiveShiftReg = receiveShiftReg;
     info.transmitBuffer = transmitBuffer;
     info.transmitShiftReg = transmitShiftReg;
+
+    publishedInfo.write(info);
 }
 
 void
@@ -17,9 +17,11 @@
 class UART : public SubComponent {
     
     friend class SerServer;
+    friend class InputRecorder;
     
     // Result of the latest inspection
     mutable UARTInfo info = {};
+    mutable util::Seqlock<UARTInfo> publishedInfo;
 
     // Port period and control register
     u16 serper;
@@ -103,7 +105,7 @@ private:
 
 public:
 
-    UARTInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    UARTInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
 
  
     //
@@ -11,6 +11,7 @@
 #include "DriveDescriptors.h"
 #include "Error.h"
 #include "IOUtils.h"
+#include <algorithm>
 #include <vector>
 
 //
@@ -43,6 +43,7 @@ FloppyDisk::init(util::SerReader &reader, Diameter dia, Density den)
 {
     init(dia, den);
     applyToPersistentItems(reader);
+    invalidateSyncMarks();
 }
 
 FloppyDisk::~FloppyDisk()
@@ -105,6 +106,7 @@ FloppyDisk::writeByte(u8 value, Track t, isize offset)
 
     data.track[t][offset] = value;
     modified = true;
+    invalidateSyncMarks(t);
 }
 
 void
@@ -116,6 +118,39 @@ FloppyDisk::writeByte(u8 value, Cylinder c, Head h, isize offset)
 
     data.cylinder[c][h][offset] = value;
     modified = true;
+    invalidateSyncMarks(2 * c + h);
+}
+
+const std::vector<i32> &
+FloppyDisk::getSyncMarks(Cylinder c, Head h)
+{
+    assert(c < numCyls());
+    assert(h < numHeads());
+
+    Track t = 2 * c + h;
+
+    if (!syncMarksValid[t]) {
+
+        auto *p = data.track[t];
+        auto len = length.track[t];
+
+        // Collect all offsets, including a sync mark crossing the track end
+        syncMarks[t].clear();
+        for (i32 i = 0; i < len; i++) {
+            if (p[i] == 0x44 && p[i + 1 == len ? 0 : i + 1] == 0x89) {
+                syncMarks[t].push_back(i);
+            }
+        }
+        syncMarksValid[t] = true;
+    }
+
+    return syncMarks[t];
+}
+
+void
+FloppyDisk::invalidateSyncMarks()
+{
+    for (isize t = 0; t < 168; t++) invalidateSyncMarks(t);
 }
 
 void
@@ -140,6 +175,8 @@ FloppyDisk::clearDisk()
             data.track[t][1] = 0xA2;
         }
     }
+
+    invalidateSyncMarks();
 }
 
 void
@@ -151,6 +188,7 @@ FloppyDisk::clearTrack(Track t)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = rand() & 0xFF;
     }
+    invalidateSyncMarks(t);
 }
 
 void
@@ -161,6 +199,7 @@ FloppyDisk::clearTrack(Track t, u8 value)
     for (isize i = 0; i < isizeof(data.track[t]); i++) {
         data.track[t][i] = value;
     }
+    invalidateSyncMarks(t);
 }
 
 void
@@ -171,6 +210,7 @@ FloppyDisk::clearTrack(Track t, u8 value1, u8 value2)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = IS_ODD(i) ? value2 : value1;
     }
+    invalidateSyncMarks(t);
 }
 
 void
@@ -183,23 +223,46 @@ FloppyDisk::encodeDisk(const FloppyFile &file)
 
     // Call the MFM encoder
     file.encodeDisk(*this);
+    invalidateSyncMarks();
 }
 
+/* The following functions process multiple bytes at once by operating on
+ * 64-bit words. In an MFM stream, the bits of each data byte are interleaved
+ * with clock bits. Hence, encoding and decoding boil down to spreading and
+ * gathering bits, which is done with three mask-and-shift steps.
+ */
+
+static inline u64 load64(const u8 *p) { u64 v; std::memcpy(&v, p, 8); return v; }
+static inline void store64(u8 *p, u64 v) { std::memcpy(p, &v, 8); }
+
 void
 FloppyDisk::encodeMFM(u8 *dst, u8 *src, isize count)
 {
-    for(isize i = 0; i < count; i++) {
-        
-        auto mfm =
-        ((src[i] & 0b10000000) << 7) |
-        ((src[i] & 0b01000000) << 6) |
-        ((src[i] & 0b00100000) << 5) |
-        ((src[i] & 0b00010000) << 4) |
-        ((src[i] & 0b00001000) << 3) |
-        ((src[i] & 0b00000100) << 2) |
-        ((src[i] & 0b00000010) << 1) |
-        ((src[i] & 0b00000001) << 0);
-        
+    isize i = 0;
+
+    // Spread four data bytes to the even bits of four 16-bit words
+    for (; i + 4 <= count; i += 4) {
+
+        u64 mfm =
+        u64(src[i]) << 48 | u64(src[i+1]) << 32 | u64(src[i+2]) << 16 | src[i+3];
+
+        mfm = (mfm | mfm << 4) & 0x0F0F0F0F0F0F0F0F;
+        mfm = (mfm | mfm << 2) & 0x3333333333333333;
+        mfm = (mfm | mfm << 1) & 0x5555555555555555;
+
+        W32BE(dst + 2 * i, u32(mfm >> 32));
+        W32BE(dst + 2 * i + 4, u32(mfm));
+    }
+
+    // Encode the remaining bytes
+    for (; i < count; i++) {
+
+        u32 mfm = src[i];
+
+        mfm = (mfm | mfm << 4) & 0x0F0F;
+        mfm = (mfm | mfm << 2) & 0x3333;
+        mfm = (mfm | mfm << 1) & 0x5555;
+
         dst[2*i+0] = HI_BYTE(mfm);
         dst[2*i+1] = LO_BYTE(mfm);
     }
@@ -208,20 +271,34 @@ FloppyDisk::encodeMFM(u8 *dst, u8 *src, isize count)
 void
 FloppyDisk::decodeMFM(u8 *dst, u8 *src, isize count)
 {
-    for(isize i = 0; i < count; i++) {
-        
-        u16 mfm = HI_LO(src[2*i], src[2*i+1]);
-        
-        auto decoded =
-        ((mfm & 0b0100000000000000) >> 7) |
-        ((mfm & 0b0001000000000000) >> 6) |
-        ((mfm & 0b0000010000000000) >> 5) |
-        ((mfm & 0b0000000100000000) >> 4) |
-        ((mfm & 0b0000000001000000) >> 3) |
-        ((mfm & 0b0000000000010000) >> 2) |
-        ((mfm & 0b0000000000000100) >> 1) |
-        ((mfm & 0b0000000000000001) >> 0);
-        
+    isize i = 0;
+
+    // Gather the even bits of four 16-bit words
+    for (; i + 4 <= count; i += 4) {
+
+        u64 decoded = u64(R32BE(src + 2 * i)) << 32 | R32BE(src + 2 * i + 4);
+
+        decoded &= 0x5555555555555555;
+        decoded = (decoded | decoded >> 1) & 0x3333333333333333;
+        decoded = (decoded | decoded >> 2) & 0x0F0F0F0F0F0F0F0F;
+        decoded = (decoded | decoded >> 4) & 0x00FF00FF00FF00FF;
+
+        dst[i+0] = u8(decoded >> 48);
+        dst[i+1] = u8(decoded >> 32);
+        dst[i+2] = u8(decoded >> 16);
+        dst[i+3] = u8(decoded);
+    }
+
+    // Decode the remaining bytes
+    for (; i < count; i++) {
+
+        u32 decoded = HI_LO(src[2*i], src[2*i+1]);
+
+        decoded &= 0x5555;
+        decoded = (decoded | decoded >> 1) & 0x3333;
+        decoded = (decoded | decoded >> 2) & 0x0F0F;
+        decoded = (decoded | decoded >> 4) & 0x00FF;
+
         dst[i] = (u8)decoded;
     }
 }
@@ -229,31 +306,65 @@ FloppyDisk::decodeMFM(u8 *dst, u8 *src, isize count)
 void
 FloppyDisk::encodeOddEven(u8 *dst, u8 *src, isize count)
 {
-    // Encode odd bits
-    for(isize i = 0; i < count; i++)
+    isize i = 0;
+
+    // Encode odd bits and even bits
+    for (; i + 8 <= count; i += 8) {
+
+        u64 value = load64(src + i);
+        store64(dst + i, (value >> 1) & 0x5555555555555555);
+        store64(dst + i + count, value & 0x5555555555555555);
+    }
+    for (; i < count; i++) {
+
         dst[i] = (src[i] >> 1) & 0x55;
-    
-    // Encode even bits
-    for(isize i = 0; i < count; i++)
         dst[i + count] = src[i] & 0x55;
+    }
 }
 
 void
 FloppyDisk::decodeOddEven(u8 *dst, u8 *src, isize count)
 {
-    // Decode odd bits
-    for(isize i = 0; i < count; i++)
-        dst[i] = (u8)((src[i] & 0x55) << 1);
-    
-    // Decode even bits
-    for(isize i = 0; i < count; i++)
-        dst[i] |= src[i + count] & 0x55;
+    isize i = 0;
+
+    // Decode odd bits and even bits
+    for (; i + 8 <= count; i += 8) {
+
+        u64 odd = load64(src + i) & 0x5555555555555555;
+        u64 even = load64(src + i + count) & 0x5555555555555555;
+        store64(dst + i, odd << 1 | even);
+    }
+    for (; i < count; i++) {
+
+        dst[i] = (u8)((src[i] & 0x55) << 1) | (src[i + count] & 0x55);
+    }
 }
 
 void
 FloppyDisk::addClockBits(u8 *dst, isize count)
 {
-    for (isize i = 0; i < count; i++) {
+    isize i = 0;
+
+    /* Each clock bit only depends on its two neighbouring data bits. Since
+     * data bits are left untouched, all bytes can be processed in parallel.
+     */
+    for (; i + 8 <= count; i += 8) {
+
+        u64 value = u64(R32BE(dst + i)) << 32 | R32BE(dst + i + 4);
+
+        // Clear all previously set clock bits
+        value &= 0x5555555555555555;
+
+        // Compute clock bits (clock bit values are inverted)
+        u64 cBitsInv = value << 1 | value >> 1 | u64(dst[i-1]) << 63;
+
+        // Add the reversed clock bits
+        value |= ~cBitsInv & 0xAAAAAAAAAAAAAAAA;
+
+        W32BE(dst + i, u32(value >> 32));
+        W32BE(dst + i + 4, u32(value));
+    }
+    for (; i < count; i++) {
         dst[i] = addClockBits(dst[i], dst[i-1]);
     }
 }
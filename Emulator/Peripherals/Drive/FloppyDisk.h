@@ -11,6 +11,7 @@
 
 #include "FloppyDiskTypes.h"
 #include "AmigaComponent.h"
+#include <vector>
 
 /* MFM encoded disk data of a standard 3.5" DD disk:
  *
@@ -53,6 +54,7 @@ class FloppyDisk : public AmigaObject {
     friend class ADFFile;
     friend class EXTFile;
     friend class IMGFile;
+    friend class InputRecorder;
     
 public:
     
@@ -77,6 +79,12 @@ private:
         i32 track[168];
     } length;
 
+    /* Offsets of all sync marks (0x4489) in each track. The index is built
+     * lazily when a track is searched for a sync mark and thrown away when
+     * the track gets modified.
+     */
+    std::vector<i32> syncMarks[168];
+    bool syncMarksValid[168] = { };
     
     // Indicates if this disk is write protected
     bool writeProtected = false;
@@ -171,6 +179,15 @@ public:
     // Writes a byte to disk
     void writeByte(u8 value, Track t, isize offset);
     void writeByte(u8 value, Cylinder c, Head h, isize offset);
+
+    // Returns the offsets of all sync marks in a track
+    const std::vector<i32> &getSyncMarks(Cylinder c, Head h);
+
+private:
+
+    // Marks the sync mark index of a single track or all tracks as outdated
+    void invalidateSyncMarks(Track t) { syncMarksValid[t] = false; }
+    void invalidateSyncMarks();
         
     
     //
@@ -197,6 +197,8 @@ FloppyDrive::_inspect() const
         info.head = head;
         info.hasDisk = hasDisk();
         info.motor = getMotor();
+
+        publishedInfo.write(info);
     }
 }
 
@@ -584,6 +586,30 @@ FloppyDrive::readWordAndRotate()
     return HI_LO(byte1, byte2);
 }
 
+void
+FloppyDrive::readBlockAndRotate(u8 *dst, isize count)
+{
+    if (!canStream()) {
+
+        for (isize i = 0; i < count; i++) dst[i] = readByteAndRotate();
+        return;
+    }
+
+    auto *track = disk->data.cylinder[head.cylinder][head.head];
+    isize length = disk->length.cylinder[head.cylinder][head.head];
+
+    // Copy the data in chunks that end at the end of the track
+    while (count > 0) {
+
+        isize chunk = std::min(count, length - head.offset);
+        std::memcpy(dst, track + head.offset, chunk);
+        rotate(chunk);
+
+        dst += chunk;
+        count -= chunk;
+    }
+}
+
 void
 FloppyDrive::writeByte(u8 value)
 {
@@ -622,20 +648,101 @@ FloppyDrive::rotate()
     }
 }
 
+void
+FloppyDrive::rotate(isize count)
+{
+    long last = disk ? disk->length.cylinder[head.cylinder][head.head] : 12668;
+
+    // Emulate all index pulses that show up while the disk is rotating
+    for (head.offset += count; head.offset >= last; head.offset -= last) {
+        if (isSelected()) ciab.emulateFallingEdgeOnFlagPin();
+    }
+}
+
+bool
+FloppyDrive::canStream() const
+{
+    if (!disk || !motor) return false;
+
+    // While stepping, readByte() returns random data
+    if (config.mechanicalDelays && (agnus.clock - stepCycle) < config.stepDelay) {
+        return false;
+    }
+
+    return head.offset < disk->length.cylinder[head.cylinder][head.head];
+}
+
 void
 FloppyDrive::findSyncMark()
 {
-    long length = disk->length.cylinder[head.cylinder][head.head];
-    for (isize i = 0; i < length; i++) {
-        
-        if (readByteAndRotate() != 0x44) continue;
-        if (readByteAndRotate() != 0x89) continue;
-        break;
+    long length = disk ? disk->length.cylinder[head.cylinder][head.head] : 12668;
+
+    // Try to jump to the next sync mark directly
+    if (!skipToSyncMark()) {
+
+        for (isize i = 0; i < length; i++) {
+
+            if (readByteAndRotate() != 0x44) continue;
+            if (readByteAndRotate() != 0x89) continue;
+            break;
+        }
     }
 
     trace(DSK_DEBUG, "Moving to SYNC mark at offset %ld\n", head.offset);
 }
 
+bool
+FloppyDrive::skipToSyncMark()
+{
+    if (!canStream()) return false;
+
+    auto *track = disk->data.cylinder[head.cylinder][head.head];
+    auto &marks = disk->getSyncMarks(head.cylinder, head.head);
+    isize length = disk->length.cylinder[head.cylinder][head.head];
+    isize start = head.offset;
+
+    if (marks.empty()) return false;
+
+    // Distance of a track offset from the current head position
+    auto distance = [&](isize offset) {
+        return offset >= start ? offset - start : offset - start + length;
+    };
+
+    /* The byte loop in findSyncMark() consumes two bytes whenever it sees
+     * 0x44. Hence, inside a run of 0x44 bytes, only every other byte is
+     * checked for being the start of a sync mark. A sync mark is detected iff
+     * it has an even distance to the beginning of the run it belongs to.
+     */
+    auto first = std::lower_bound(marks.begin(), marks.end(), i32(start));
+    isize from = 0;
+
+    for (isize i = 0; i < isize(marks.size()); i++) {
+
+        auto it = first + i;
+        if (it >= marks.end()) it -= marks.size();
+
+        isize dist = distance(*it);
+
+        // Stick to the byte loop if the sync mark is not in the first round
+        if (dist + 2 > length) return false;
+
+        // Find the beginning of the 0x44 run
+        isize run = dist;
+        while (run > from && track[(start + run - 1) % length] == 0x44) run--;
+
+        if ((dist - run) % 2 == 0) {
+
+            rotate(dist + 2);
+            return true;
+        }
+
+        // The byte loop continues behind the skipped sync mark
+        from = dist + 1;
+    }
+
+    return false;
+}
+
 bool
 FloppyDrive::readyToStep() const
 {
@@ -772,14 +879,11 @@ FloppyDrive::ejectDisk(Cycle delay)
 {
     debug(DSK_DEBUG, "ejectDisk <%ld> (%lld)\n", s, delay);
     
-    {   SUSPENDED
-
-        // Schedule an ejection event
-        agnus.scheduleRel <s> (delay, DCH_EJECT);
+    // Schedule an ejection event
+    agnus.scheduleRel <s> (delay, DCH_EJECT);
 
-        // If there is no delay, service the event immediately
-        if (delay == 0) serviceDiskChangeEvent <s> ();
-    }
+    // If there is no delay, service the event immediately
+    if (delay == 0) serviceDiskChangeEvent <s> ();
 }
 
 void
@@ -787,6 +891,15 @@ FloppyDrive::ejectDisk(Cycle delay)
 {
     debug(DSK_DEBUG, "ejectDisk(%lld)\n", delay);
     
+    Cmd cmd = { .type = CMD_DSK_EJECT };
+    cmd.disk = { .drive = nr, .delay = delay, .disk = nullptr };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the request through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     if (nr == 0) ejectDisk <SLOT_DC0> (delay);
     if (nr == 1) ejectDisk <SLOT_DC1> (delay);
     if (nr == 2) ejectDisk <SLOT_DC2> (delay);
@@ -800,20 +913,14 @@ FloppyDrive::insertDisk(std::unique_ptr<FloppyDisk> disk, Cycle delay)
     
     debug(DSK_DEBUG, "insertDisk <%ld> (%lld)\n", s, delay);
 
-    // Only proceed if the provided disk is compatible with this drive
-    if (!isInsertable(*disk)) throw VAError(ERROR_DISK_INCOMPATIBLE);
-
-    {   SUSPENDED
-        
-        // Get ownership of the disk
-        diskToInsert = std::move(disk);
+    // Get ownership of the disk
+    diskToInsert = std::move(disk);
 
-        // Schedule an insertion event
-        agnus.scheduleRel <s> (delay, DCH_INSERT);
+    // Schedule an insertion event
+    agnus.scheduleRel <s> (delay, DCH_INSERT);
 
-        // If there is no delay, service the event immediately
-        if (delay == 0) serviceDiskChangeEvent <s> ();
-    }
+    // If there is no delay, service the event immediately
+    if (delay == 0) serviceDiskChangeEvent <s> ();
 }
 
 void
@@ -859,8 +966,27 @@ FloppyDrive::catchFile(const string &path)
 void
 FloppyDrive::insertDisk(std::unique_ptr<FloppyDisk> disk, Cycle delay)
 {
+    assert(disk != nullptr);
+
     debug(DSK_DEBUG, "insertDisk(%lld)\n", delay);
     
+    // Only proceed if the provided disk is compatible with this drive
+    if (!isInsertable(*disk)) throw VAError(ERROR_DISK_INCOMPATIBLE);
+
+    Cmd cmd = { .type = CMD_DSK_INSERT };
+    cmd.disk = { .drive = nr, .delay = delay, .disk = disk.get() };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) {
+
+        // Pass the ownership of the disk to the command
+        disk.release();
+        return;
+    }
+
+    // Pass the request through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     if (nr == 0) insertDisk <SLOT_DC0> (std::move(disk), delay);
     if (nr == 1) insertDisk <SLOT_DC1> (std::move(disk), delay);
     if (nr == 2) insertDisk <SLOT_DC2> (std::move(disk), delay);
@@ -902,22 +1028,19 @@ FloppyDrive::swapDisk(std::unique_ptr<FloppyDisk> disk)
     // Determine delay (in pause mode, we insert immediately)
     auto delay = isRunning() ? config.diskSwapDelay : 0;
         
-    {   SUSPENDED
-
-        if (hasDisk()) {
+    if (hasDisk()) {
 
-            // Eject the old disk first
-            ejectDisk();
+        // Eject the old disk first
+        ejectDisk();
 
-        } else {
+    } else {
 
-            // Insert the new disk immediately
-            delay = 0;
-        }
-                
-        // Insert the new disk with a delay
-        insertDisk(std::move(disk), delay);
+        // Insert the new disk immediately
+        delay = 0;
     }
+
+    // Insert the new disk with a delay
+    insertDisk(std::move(disk), delay);
 }
 
 void
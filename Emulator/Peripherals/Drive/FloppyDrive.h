@@ -27,6 +27,7 @@ class FloppyDrive : public Drive {
 
     // Result of the latest inspection
     mutable FloppyDriveInfo info = {};
+    mutable util::Seqlock<FloppyDriveInfo> publishedInfo;
 
     // The current head location
     DriveHead head;
@@ -195,7 +196,7 @@ public:
 public:
     
     // Returns the result of the latest inspection
-    FloppyDriveInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    FloppyDriveInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
  
     // Return the identification pattern of this drive
     u32 getDriveId() const;
@@ -250,6 +251,7 @@ public:
     u8 readByte() const;
     u8 readByteAndRotate();
     u16 readWordAndRotate();
+    void readBlockAndRotate(u8 *dst, isize count);
 
     // Writes a value to the drive head and optionally rotates the disk
     void writeByte(u8 value);
@@ -258,10 +260,18 @@ public:
 
     // Emulate a disk rotation (moves head to the next byte)
     void rotate();
+    void rotate(isize count);
+
+    // Checks if the disk data can be accessed without any side effects
+    bool canStream() const;
 
     // Rotates the disk to the next sync mark
     void findSyncMark();
 
+private:
+
+    // Uses the sync mark index of the disk to perform the same operation
+    bool skipToSyncMark();
     
     //
     // Moving the drive head
@@ -292,10 +302,11 @@ public:
     bool isInsertable(const FloppyFile &file) const;
     bool isInsertable(const FloppyDisk &disk) const;
 
-    // Ejects the current disk with an optional delay
+    /* Ejects the current disk or inserts a new one with an optional delay. If
+     * the emulator is running, the request is handed over to the emulator
+     * thread via the command queue and carried out asynchronously.
+     */
     void ejectDisk(Cycle delay = 0);
-    
-    // Inserts a new disk with an optional delay
     void insertDisk(std::unique_ptr<FloppyDisk> disk, Cycle delay = 0) throws;
     
     // Replaces the current disk (recommended way to insert disks)
@@ -38,9 +38,16 @@ HardDrive::HardDrive(Amiga& ref, isize nr) : Drive(ref, nr)
     }
 }
 
+HardDrive::~HardDrive()
+{
+    discardVolume();
+}
+
 void
 HardDrive::init()
 {
+    discardVolume();
+
     data.dealloc();
 
     diskVendor = "VAMIGA";
@@ -130,6 +137,28 @@ HardDrive::init(const HDFFile &hdf)
     hdf.flash(data.ptr, 0, numBytes);
 }
 
+void
+HardDrive::init(const fs::path &path, isize size)
+{
+    auto geometry = GeometryDescriptor(size);
+
+    // Throw an exception if the geometry is not supported
+    geometry.checkCompatibility();
+
+    // Wipe out the old drive
+    init();
+
+    // Create the drive description
+    this->geometry = geometry;
+    ptable.push_back(PartitionDescriptor(geometry));
+    ptable[0].dosType = 0x444F5301;
+
+    // Mirror the directory (blocks are created on demand)
+    volume = std::make_unique<DirectoryVolume>(path, geometry.numBlocks(), defaultName());
+
+    assert(volume->numBytes() == geometry.numBytes());
+}
+
 const char *
 HardDrive::getDescription() const
 {
@@ -145,6 +174,57 @@ HardDrive::_reset(bool hard)
     if constexpr (FORCE_HDR_MODIFIED) { modified = true; }
 }
 
+isize
+HardDrive::_load(const u8 *buffer)
+{
+    // The restored state supersedes the mirrored directory
+    discardVolume();
+
+    LOAD_SNAPSHOT_ITEMS
+}
+
+void
+HardDrive::_didLoad()
+{
+    // Reattach the mirrored directory (if any)
+    if (volumeState.size) {
+
+        try {
+
+            volume = std::make_unique<DirectoryVolume>(volumeState);
+            volumeRevision = volume->getRevision();
+
+        } catch (VAError &err) {
+
+            warn("%s: Can't reattach the host directory: %s\n", getDescription(), err.what());
+            volumeState.dealloc();
+        }
+    }
+}
+
+void
+HardDrive::updateVolumeState()
+{
+    if (volume && volume->getRevision() != volumeRevision) {
+
+        volume->saveState(volumeState);
+        volumeRevision = volume->getRevision();
+    }
+}
+
+void
+HardDrive::discardVolume()
+{
+    if (volume && volume->isDirty()) {
+
+        warn("%s: Discarding unflushed changes to %s\n",
+             getDescription(), volume->getPath().string().c_str());
+    }
+    volume = nullptr;
+    volumeState.dealloc();
+    volumeRevision = -1;
+}
+
 HardDriveConfig
 HardDrive::getDefaultConfig(isize nr)
 {
@@ -252,6 +332,8 @@ HardDrive::_inspect() const
         
         info.modified = isModified();
         info.head = head;
+
+        publishedInfo.write(info);
     }
 }
 
@@ -298,7 +380,11 @@ HardDrive::_dump(Category category, std::ostream& os) const
         os << controllerRevision << std::endl;
     }
     
-    if (category == Category::Volumes) {
+    if (category == Category::Volumes && volume) {
+
+        volume->dump(Category::Volumes, os);
+
+    } else if (category == Category::Volumes) {
         
         os << "Type   Size            Used    Free    Full  Name" << std::endl;
         
@@ -356,13 +442,14 @@ HardDrive::isConnected() const
 u64
 HardDrive::fnv() const
 {
+    if (volume) return volume->fnv();
     return hasDisk() ? util::fnv64(data.ptr, geometry.numBytes()) : 0;
 }
 
 bool
 HardDrive::hasDisk() const
 {
-    return data.ptr != nullptr;
+    return data.ptr != nullptr || volume != nullptr;
 }
 
 bool
@@ -465,7 +552,21 @@ HardDrive::read(isize offset, isize length, u32 addr)
         moveHead(offset / geometry.bsize);
 
         // Perform the read operation
-        mem.patch(addr, data.ptr + offset, length);
+        if (volume) {
+
+            auto bsize = geometry.bsize;
+            Buffer<u8> buffer(bsize);
+
+            for (isize i = 0; i < length; i += bsize) {
+
+                volume->readBlock(Block((offset + i) / bsize), buffer.ptr);
+                mem.patch(u32(addr + i), buffer.ptr, bsize);
+            }
+
+        } else {
+
+            mem.patch(addr, data.ptr + offset, length);
+        }
                 
         // Inform the GUI
         msgQueue.put(MSG_HDR_READ);
@@ -493,7 +594,19 @@ HardDrive::write(isize offset, isize length, u32 addr)
         moveHead(offset / geometry.bsize);
 
         // Perform the write operation
-        if (!writeProtected) {
+        if (!writeProtected && volume) {
+
+            auto bsize = geometry.bsize;
+            Buffer<u8> buffer(bsize);
+
+            for (isize i = 0; i < length; i += bsize) {
+
+                mem.spypeek <ACCESSOR_CPU> (u32(addr + i), bsize, buffer.ptr);
+                volume->writeBlock(Block((offset + i) / bsize), buffer.ptr);
+            }
+
+        } else if (!writeProtected) {
+
             mem.spypeek <ACCESSOR_CPU> (addr, length, data.ptr + offset);
         }
         
@@ -507,10 +620,16 @@ HardDrive::write(isize offset, isize length, u32 addr)
     return error;
 }
 
+void
+HardDrive::flush()
+{
+    if (volume) volume->flush();
+}
+
 i8
 HardDrive::verify(isize offset, isize length, u32 addr)
 {
-    assert(data.ptr);
+    assert(hasDisk());
 
     if (length % 512) {
         
@@ -13,6 +13,7 @@
 #include "Drive.h"
 #include "AgnusTypes.h"
 #include "HDFFile.h"
+#include "DirectoryVolume.h"
 #include "MemUtils.h"
 
 class HardDrive : public Drive {
@@ -25,6 +26,7 @@ class HardDrive : public Drive {
     
     // Result of the latest inspection
     mutable HardDriveInfo info = {};
+    mutable util::Seqlock<HardDriveInfo> publishedInfo;
 
     // Product information
     string diskVendor;
@@ -42,6 +44,15 @@ class HardDrive : public Drive {
             
     // Disk data
     Buffer<u8> data;
+
+    // Host directory mirrored by this drive (replaces 'data' if present)
+    std::unique_ptr<DirectoryVolume> volume;
+
+    // Snapshot representation of 'volume' (empty if no directory is mirrored)
+    Buffer<u8> volumeState;
+
+    // Volume revision 'volumeState' has been computed for
+    isize volumeRevision = -1;
     
     // Current position of the read/write head
     DriveHead head;
@@ -61,6 +72,7 @@ class HardDrive : public Drive {
 public:
 
     HardDrive(Amiga& ref, isize nr);
+    ~HardDrive();
         
     // Creates a hard drive with a certain geometry
     void init(const GeometryDescriptor &geometry);
@@ -74,6 +86,9 @@ public:
     // Creates a hard drive with the contents of an HDF
     void init(const HDFFile &hdf) throws;
 
+    // Creates a hard drive that mirrors a host directory on demand
+    void init(const fs::path &path, isize size) throws;
+
 private:
 
     // Restors the initial state
@@ -117,6 +132,7 @@ private:
         >> geometry
         >> ptable
         << data
+        << volumeState
         << modified
         << writeProtected;
     }
@@ -135,10 +151,20 @@ private:
         }
     }
 
-    isize _size() override { COMPUTE_SNAPSHOT_SIZE }
-    u64 _checksum() override { COMPUTE_SNAPSHOT_CHECKSUM }
-    isize _load(const u8 *buffer) override { LOAD_SNAPSHOT_ITEMS }
-    isize _save(u8 *buffer) override { SAVE_SNAPSHOT_ITEMS }
+    isize _size() override { updateVolumeState(); COMPUTE_SNAPSHOT_SIZE }
+    u64 _checksum() override { updateVolumeState(); COMPUTE_SNAPSHOT_CHECKSUM }
+    isize _load(const u8 *buffer) override;
+    void _didLoad() override;
+    isize _save(u8 *buffer) override { updateVolumeState(); SAVE_SNAPSHOT_ITEMS }
+
+    /* Snapshots don't contain the blocks of a mirrored directory. They store
+     * the volume state instead, which is used to reattach the directory when
+     * the snapshot is restored (see DirectoryVolume::saveState()).
+     */
+    void updateVolumeState();
+
+    // Detaches the mirrored directory (unflushed changes are lost)
+    void discardVolume();
 
     
     //
@@ -189,7 +215,7 @@ public:
 public:
 
     // Returns information about the disk or one of its partitions
-    HardDriveInfo getInfo() const { return AmigaComponent::getInfo(info); }
+    HardDriveInfo getInfo() const { return AmigaComponent::getInfo(info, publishedInfo); }
     const PartitionDescriptor &getPartitionInfo(isize nr);
     
     // Returns the disk geometry
@@ -200,6 +226,9 @@ public:
         
     // Returns the current drive state
     HardDriveState getState() const { return state; }
+
+    // Checks whether the drive mirrors a host directory
+    bool isDirectoryBacked() const { return volume != nullptr; }
     
     // Gets or sets the 'modification' flag
     bool isModified() const { return modified; }
@@ -232,6 +261,9 @@ public:
     
     // Reads a data block from RAM and writes it onto the hard drive
     i8 write(isize offset, isize length, u32 addr);
+
+    // Transfers modified files back to the host (directory-backed drives)
+    void flush() throws;
     
 private:
         
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Joystick.h"
 #include "Agnus.h"
+#include "Amiga.h"
 #include "ControlPort.h"
 #include "IOUtils.h"
 
@@ -185,7 +186,16 @@ Joystick::trigger(GamePadAction event)
     assert_enum(GamePadAction, event);
 
     debug(PRT_DEBUG, "trigger(%s)\n", GamePadActionEnum::key(event));
-     
+
+    Cmd cmd = { .type = CMD_JOY_EVENT };
+    cmd.port = { .port = port.isPort2() ? PORT_2 : PORT_1, .action = event };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the event through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     switch (event) {
             
         case PULL_UP:    axisY = -1; break;
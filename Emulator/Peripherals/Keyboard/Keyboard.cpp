@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Keyboard.h"
 #include "Agnus.h"
+#include "Amiga.h"
 #include "CIA.h"
 #include "IOUtils.h"
 #include "MsgQueue.h"
@@ -116,7 +117,16 @@ void
 Keyboard::pressKey(KeyCode keycode)
 {
     assert(keycode < 0x80);
-    
+
+    Cmd cmd = { .type = CMD_KEY_PRESS };
+    cmd.key = { .keycode = keycode };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the key through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     SYNCHRONIZED
     
     if (!keyDown[keycode] && !queue.isFull()) {
@@ -138,7 +148,16 @@ void
 Keyboard::releaseKey(KeyCode keycode)
 {
     assert(keycode < 0x80);
-    
+
+    Cmd cmd = { .type = CMD_KEY_RELEASE };
+    cmd.key = { .keycode = keycode };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the key through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     SYNCHRONIZED
     
     if (keyDown[keycode] && !queue.isFull()) {
@@ -161,7 +180,7 @@ void
 Keyboard::releaseAllKeys()
 {
     for (KeyCode i = 0; i < 0x80; i++) {
-        releaseKey(i);
+        if (keyDown[i]) releaseKey(i);
     }
 }
 
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Mouse.h"
 #include "Agnus.h"
+#include "Amiga.h"
 #include "Chrono.h"
 #include "ControlPort.h"
 #include "IOUtils.h"
@@ -233,6 +234,15 @@ Mouse::setXY(double x, double y)
 {
     debug(PRT_DEBUG, "setXY(%f,%f)\n", x, y);
 
+    Cmd cmd = { .type = CMD_MOUSE_MOVE_ABS };
+    cmd.port = { .port = port.isPort2() ? PORT_2 : PORT_1, .x = x, .y = y };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the movement through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     targetX = x * scaleX;
     targetY = y * scaleY;
     
@@ -244,7 +254,16 @@ void
 Mouse::setDxDy(double dx, double dy)
 {
     debug(PRT_DEBUG, "setDxDy(%f,%f)\n", dx, dy);
-    
+
+    Cmd cmd = { .type = CMD_MOUSE_MOVE_REL };
+    cmd.port = { .port = port.isPort2() ? PORT_2 : PORT_1, .x = dx, .y = dy };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the movement through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     targetX += dx * scaleX;
     targetY += dy * scaleY;
     
@@ -277,6 +296,15 @@ Mouse::trigger(GamePadAction event)
 
     debug(PRT_DEBUG, "trigger(%s)\n", GamePadActionEnum::key(event));
 
+    Cmd cmd = { .type = CMD_MOUSE_EVENT };
+    cmd.port = { .port = port.isPort2() ? PORT_2 : PORT_1, .action = event };
+
+    // Let the emulator thread carry out the request if it is running
+    if (amiga.forward(cmd)) return;
+
+    // Pass the event through the input recorder
+    if (!inputRecorder.intercept(cmd)) return;
+
     switch (event) {
 
         case PRESS_LEFT: setLeftButton(true); break;
@@ -378,25 +406,25 @@ Mouse::serviceMouseEvent()
 
         case MSE_PUSH_LEFT:
             
-            setLeftButton(true);
+            trigger(PRESS_LEFT);
             agnus.scheduleRel <s> (duration, MSE_RELEASE_LEFT);
             break;
             
         case MSE_RELEASE_LEFT:
             
-            setLeftButton(false);
+            trigger(RELEASE_LEFT);
             agnus.cancel <s> ();
             break;
 
         case MSE_PUSH_RIGHT:
             
-            setRightButton(true);
+            trigger(PRESS_RIGHT);
             agnus.scheduleRel <s> (duration, MSE_RELEASE_RIGHT);
             break;
             
         case MSE_RELEASE_RIGHT:
             
-            setRightButton(false);
+            trigger(RELEASE_RIGHT);
             agnus.cancel <s> ();
             break;
 
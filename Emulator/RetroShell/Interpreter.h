@@ -24,13 +24,13 @@ enum class Token
     cutout, dc, debug, delay, del, denise, detach, device, devices, dfn,
     diagboard, down, hdn, disable, disconnect, disk, dma, dmadebugger, drive,
     dsksync, easteregg, eject, enable, esync, events, execbase, extrom,
-    extstart, fast, filename, filesystem, filter, gdb, geometry, help, hide,
-    ignore, init, info, insert, inspect, interrupt, interrupts, joystick, jump,
+    extstart, fast, filename, filesystem, filter, flush, gdb, geometry, help, hide,
+    ignore, init, info, input, insert, inspect, interrupt, interrupts, joystick, jump,
     keyboard, keyset, layers, left, library, libraries, list, load, lock,
-    mechanics, memory, mode, model, monitor, mouse, none, off, on, opacity,
-    open, os, palette, pan, partition, path, paula, pause, poll, port, ports,
-    power, press, process, processes, pull, pullup, raminitpattern, refresh,
-    registers, regreset, regression, release, reset, resource, resources,
+    manifest, mechanics, memory, mode, model, monitor, mouse, none, off, on, opacity,
+    open, os, palette, pan, partition, path, paula, pause, play, poll, port, ports,
+    power, press, process, processes, pull, pullup, raminitpattern, record,
+    refresh, registers, regreset, regression, release, reset, resource, resources,
     revision, right, rom, rshell, rtc, run, sampling, saturation, save,
     saveroms, screenshot, searchpath, serial, server, set, setup,
     shakedetector, show, slow, slowramdelay, slowrammirror, source, speed,
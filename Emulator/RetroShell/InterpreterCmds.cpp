@@ -78,6 +78,10 @@ Interpreter::registerInstructions()
              "key", "Adjusts the texture cutout",
              &RetroShell::exec <Token::screenshot, Token::set, Token::cutout>, 4);
 
+    root.add({"screenshot", "set", "manifest"},
+             "key", "Assigns the golden-hash manifest",
+             &RetroShell::exec <Token::screenshot, Token::set, Token::manifest>, 1);
+
     root.add({"screenshot", "save"},
              "key", "Saves a screenshot and exits the emulator",
              &RetroShell::exec <Token::screenshot, Token::save>, 1);
@@ -1010,6 +1014,30 @@ Interpreter::registerInstructions()
                  "command", "Releases the y-axis",
                  &RetroShell::exec <Token::joystick, Token::release, Token::yaxis>, 0, i);
     }
+
+
+    //
+    // Input recorder
+    //
+
+    root.add({"input"},
+             "component", "Input recorder");
+
+    root.add({"input", "record"},
+             "command", "Resets the Amiga and records all inputs",
+             &RetroShell::exec <Token::input, Token::record>, 1);
+
+    root.add({"input", "play"},
+             "command", "Resets the Amiga and plays back recorded inputs",
+             &RetroShell::exec <Token::input, Token::play>, 1);
+
+    root.add({"input", "stop"},
+             "command", "Stops recording or playing back",
+             &RetroShell::exec <Token::input, Token::stop>, 0);
+
+    root.add({"input", "inspect"},
+             "command", "Displays the internal state",
+             &RetroShell::exec <Token::input, Token::inspect>, 0);
     
     
     //
@@ -1248,6 +1276,14 @@ Interpreter::registerInstructions()
         root.add({hd, "geometry"},
                  "command", "Changes the disk geometry",
                  &RetroShell::exec <Token::hdn, Token::geometry>, 3, i);
+
+        root.add({hd, "attach"},
+                 "command", "Mirrors a host directory (path, capacity in MB)",
+                 &RetroShell::exec <Token::hdn, Token::attach>, 2, i);
+
+        root.add({hd, "flush"},
+                 "command", "Writes modified files back to the host directory",
+                 &RetroShell::exec <Token::hdn, Token::flush>, 0, i);
     }
     
     //
@@ -110,6 +110,12 @@ RetroShell::exec <Token::screenshot, Token::set, Token::cutout> (Arguments &argv
     amiga.regressionTester.y2 = y2;
 }
 
+template <> void
+RetroShell::exec <Token::screenshot, Token::set, Token::manifest> (Arguments &argv, long param)
+{
+    amiga.regressionTester.loadManifest(argv.front());
+}
+
 template <> void
 RetroShell::exec <Token::screenshot, Token::save> (Arguments &argv, long param)
 {
@@ -1196,6 +1202,35 @@ RetroShell::exec <Token::joystick, Token::release, Token::yaxis> (Arguments& arg
 }
 
 
+//
+// Input recorder
+//
+
+template <> void
+RetroShell::exec <Token::input, Token::record> (Arguments& argv, long param)
+{
+    amiga.inputRecorder.startRecording(argv.front());
+}
+
+template <> void
+RetroShell::exec <Token::input, Token::play> (Arguments& argv, long param)
+{
+    amiga.inputRecorder.startPlayback(argv.front());
+}
+
+template <> void
+RetroShell::exec <Token::input, Token::stop> (Arguments& argv, long param)
+{
+    amiga.inputRecorder.stop();
+}
+
+template <> void
+RetroShell::exec <Token::input, Token::inspect> (Arguments& argv, long param)
+{
+    dump(amiga.inputRecorder, Category::State);
+}
+
+
 //
 // Serial port
 //
@@ -1484,6 +1519,25 @@ RetroShell::exec <Token::hdn, Token::geometry> (Arguments& argv, long param)
     amiga.hd[param]->changeGeometry(c, h, s);
 }
 
+template <> void
+RetroShell::exec <Token::hdn, Token::attach> (Arguments& argv, long param)
+{
+    auto path = argv[0];
+    auto size = util::parseNum(argv[1]);
+
+    if (!amiga.isPoweredOff()) throw VAError(ERROR_OPT_LOCKED);
+    
+    amiga.hd[param]->init(path, MB(size));
+}
+
+template <> void
+RetroShell::exec <Token::hdn, Token::flush> (Arguments& argv, long param)
+{
+    SUSPENDED
+
+    amiga.hd[param]->flush();
+}
+
 //
 // Zorro boards
 //
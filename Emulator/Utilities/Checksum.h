@@ -30,4 +30,7 @@ u16 crc16(const u8 *addr, isize size);
 u32 crc32(const u8 *addr, isize size);
 u32 crc32forByte(u32 r);
 
+// Computes a SHA-256 digest for a given buffer (in hexadecimal notation)
+string sha256(const u8 *addr, isize size);
+
 }
@@ -9,9 +9,47 @@
 
 #include "config.h"
 #include "Concurrency.h"
+#include <vector>
 
 namespace util {
 
+void
+parallelFor(isize count, const std::function<void(isize)> &func)
+{
+    isize workers = std::min(count, isize(std::thread::hardware_concurrency()));
+
+    // Run sequentially if there is nothing to distribute
+    if (workers <= 1) {
+        for (isize i = 0; i < count; i++) func(i);
+        return;
+    }
+
+    std::atomic<isize> next = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+
+    auto work = [&]() {
+
+        for (isize i = next++; i < count; i = next++) {
+
+            try { func(i); } catch (...) {
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) error = std::current_exception();
+                next = count;
+            }
+        }
+    };
+
+    // Launch the worker threads (the calling thread is one of them)
+    std::vector<std::thread> pool;
+    for (isize i = 1; i < workers; i++) pool.emplace_back(work);
+    work();
+    for (auto &thread : pool) thread.join();
+
+    if (error) std::rethrow_exception(error);
+}
+
 void
 Wakeable::waitForWakeUp()
 {
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include "Types.h"
+#include <atomic>
 #include <thread>
 #include <future>
+#include <functional>
 
 namespace util {
 
@@ -46,6 +49,52 @@ public:
     ~AutoMutex() { mutex.unlock(); }
 };
 
+/* A double-buffered seqlock. The writer stores each new value in the slot
+ * that was not published last and bumps the sequence counter before and after
+ * the copy (the counter is odd while a write is in progress). A reader copies
+ * the most recently published slot and retries if the writer has started to
+ * overwrite this very slot in the meantime, which requires two consecutive
+ * writes during the copy. Hence, neither side ever waits for the other. At
+ * most one thread may write at a time.
+ */
+template <class T> class Seqlock
+{
+    T slot[2] = { };
+    std::atomic<u64> seq = 0;
+
+public:
+
+    void write(const T &value) {
+
+        auto s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot[((s >> 1) + 1) & 1] = value;
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    T read() const {
+
+        while (true) {
+
+            auto s1 = seq.load(std::memory_order_acquire);
+            T result = slot[(s1 >> 1) & 1];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto s2 = seq.load(std::memory_order_relaxed);
+
+            if (s2 <= (s1 & ~u64(1)) + 2) return result;
+        }
+    }
+};
+
+/* Invokes a function for all indices in the range [0; count). The indices
+ * are distributed dynamically among a pool of worker threads. The function
+ * returns once all invocations have completed. If an invocation throws, the
+ * remaining indices are skipped and the first exception is rethrown.
+ */
+void parallelFor(isize count, const std::function<void(isize)> &func);
+
 class Wakeable
 {
     std::promise<int> promise;
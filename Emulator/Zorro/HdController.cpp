@@ -68,7 +68,7 @@ HdController::_reset(bool hard)
 bool
 HdController::pluggedIn() const
 {
-    return drive.isConnected() && !drive.data.empty();
+    return drive.isConnected() && drive.hasDisk();
 }
 
 void
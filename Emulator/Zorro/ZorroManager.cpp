@@ -116,13 +116,32 @@ ZorroManager::updateMemSrcTables()
         
         slots[i]->updateMemSrcTables();
     }
+    
+    updatePageMap();
+}
+
+void
+ZorroManager::updatePageMap()
+{
+    for (isize page = 0; page < 256; page++) {
+        
+        pageMap[page] = nullptr;
+        
+        // If multiple boards overlap, the one in the lowest slot wins
+        for (isize i = 0; slots[i]; i++) {
+            
+            if (slots[i]->mappedIn(u32(page << 16))) {
+                
+                pageMap[page] = slots[i];
+                break;
+            }
+        }
+    }
 }
 
 ZorroBoard *
 ZorroManager::mappedInDevice(u32 addr) const
 {
-    for (isize i = 0; slots[i]; i++) {
-        if (slots[i]->mappedIn(addr)) return slots[i];
-    }
+    if (auto board = pageMap[(addr >> 16) & 0xFF]; board) return board;
     fatalError;
 }
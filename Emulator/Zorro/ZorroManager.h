@@ -34,6 +34,9 @@ private:
         nullptr
     };
     
+    // Lookup table mapping each 64 KB page to the board mapped in there
+    ZorroBoard *pageMap[256] = { };
+    
             
     //
     // Initializing
@@ -61,6 +64,7 @@ private:
 private:
     
     void _reset(bool hard) override { RESET_SNAPSHOT_ITEMS(hard) }
+    void _didLoad() override { updatePageMap(); }
 
     template <class T>
     void applyToPersistentItems(T& worker) { }
@@ -104,6 +108,9 @@ public:
     
 private:
     
+    // Rebuilds the page lookup table
+    void updatePageMap();
+    
     // Returns the mapped in device for a given address
     ZorroBoard *mappedInDevice(u32 addr) const;
 };
@@ -22,7 +22,7 @@
 // Snapshot version number
 #define SNP_MAJOR 2
 #define SNP_MINOR 0
-#define SNP_SUBMINOR 0
+#define SNP_SUBMINOR 1
 #define SNP_BETA 1
 
 // Uncomment this setting in a release build
@@ -95,6 +95,7 @@ struct FloatStereo; typedef struct FloatStereo SampleType;
 static const int NO_SEQ_FASTPATH = 0; // Disable sequencer speed optimizations
 static const int LEGACY_COPPER   = 0; // Enable deprecated Copper code
 static const int DIAG_BOARD      = 1; // Plug in the diagnose board
+static const int MEM_STATS       = 1; // Record memory access statistics
 
 
 //
@@ -210,6 +211,7 @@ static const int KBD_DEBUG       = 0; // Keyboard
 
 // Misc
 static const int REC_DEBUG       = 0; // Screen recorder
+static const int INP_DEBUG       = 0; // Input recorder
 static const int SCK_DEBUG       = 0; // Sockets
 static const int SRV_DEBUG       = 0; // Remote server
 static const int GDB_DEBUG       = 0; // GDB server